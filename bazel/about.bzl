@@ -1,7 +1,19 @@
 
-def reflection(name, hdrs, enable_meta=True, enable_enum_ostream=True, __genrule_target_name=None):
+def _default_module_name(name):
+    """
+    Returns module name derived from package path and target name, e.g. "my_pkg.sub.my_target"
+    """
+    parts = native.package_name().split("/") + [name]
+    return ".".join([p.replace("-", "_") for p in parts if p])
+
+def reflection(name, hdrs, enable_meta=True, enable_enum_ostream=True, enable_module=False, module_name=None, __genrule_target_name=None):
     """
     Generates reflection headers from input header files, hdrs
+
+    If enable_module is set, also generates:
+      - {name}.module.hpp : single header with About and all generated code, usable as a precompiled header or
+                            C++20 header unit by compilers without named module support
+      - {name}.cppm       : C++20 module interface unit, exporting the contents of {name}.module.hpp as module_name
     """
     if not (enable_meta or enable_enum_ostream):
         fail("At least one feature must be enabled! Otherwise, this rule has no affect.")
@@ -23,6 +35,17 @@ def reflection(name, hdrs, enable_meta=True, enable_enum_ostream=True, __genrule
         out_files.append(out_enum_ostream_header)
         cmd += " -oe $(location {})".format(out_enum_ostream_header)
 
+    # Use module interface / header unit generation feature
+    if enable_module:
+        out_header_unit = "{name}.module.hpp".format(name=name)
+        out_module_interface = "{name}.cppm".format(name=name)
+        out_files += [out_header_unit, out_module_interface]
+        cmd += " -ou $(location {}) -oi $(location {}) -mn {}".format(
+            out_header_unit,
+            out_module_interface,
+            module_name or _default_module_name(name),
+        )
+
     # Run the generation script
     native.genrule(
         name = __genrule_target_name,
@@ -34,20 +57,34 @@ def reflection(name, hdrs, enable_meta=True, enable_enum_ostream=True, __genrule
 
     return out_files
 
-def cc_library_with_reflection(name, hdrs, deps=[], enable_meta=True, enable_enum_ostream=True, **kwargs):
+def cc_library_with_reflection(name, hdrs, deps=[], enable_meta=True, enable_enum_ostream=True, enable_module=False, module_name=None, **kwargs):
     """
     Generates reflection headers and creates a single library with input header files, hdrs, and generated header files
+
+    If enable_module is set, the generated C++20 module interface unit is provided by the filegroup
+    {name}_module_interface, for use with module-aware toolchains; the generated {name}.module.hpp is part of the
+    library, for use as a precompiled header or header unit otherwise.
     """
     reflection_target_name = "__{name}_code_generation".format(name=name)
+    generated = reflection(
+        name=name,
+        hdrs=hdrs,
+        enable_meta=enable_meta,
+        enable_enum_ostream=enable_enum_ostream,
+        enable_module=enable_module,
+        module_name=module_name,
+        __genrule_target_name=reflection_target_name,
+    )
     native.cc_library(
         name=name,
-        hdrs=hdrs + reflection(
-            name=name,
-            hdrs=hdrs,
-            enable_meta=enable_meta,
-            enable_enum_ostream=enable_enum_ostream,
-            __genrule_target_name=reflection_target_name,
-        ),
-        deps=["//:about"] + deps,
+        hdrs=hdrs + [f for f in generated if not f.endswith(".cppm")],
+        deps=["//:about"] + (["//:utility"] if enable_module else []) + deps,
         **kwargs
     )
+
+    if enable_module:
+        native.filegroup(
+            name="{name}_module_interface".format(name=name),
+            srcs=[f for f in generated if f.endswith(".cppm")],
+            visibility=kwargs.get("visibility"),
+        )
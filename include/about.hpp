@@ -9,6 +9,65 @@
 // C++ Standard Library
 #include <type_traits>
 
+#ifdef ABOUT_PROFILE_FIELD_ACCESS
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+
+namespace about
+{
+namespace detail
+{
+
+// Defined in profile.hpp
+template <typename T> void record_field_access(const T& object, std::uint64_t members);
+template <typename T> constexpr std::uint64_t all_members_mask();
+template <std::size_t I> constexpr std::uint64_t member_mask();
+
+}  // namespace detail
+}  // namespace about
+
+/// Records access of \c members (a bit mask) of \c object, of type \c T
+#define ABOUT_RECORD_FIELD_ACCESS(T, object, members) ::about::detail::record_field_access<T>(object, members)
+
+/// Records access of \c members of \c object only if \c record (a constant expression) is \c true
+#define ABOUT_RECORD_FIELD_ACCESS_IF(record, T, object, members)                                                       \
+  ((record) ? ::about::detail::record_field_access<T>(object, members) : void())
+
+/// Recording accesses is not allowed in constant expressions
+#define ABOUT_PROFILED_CONSTEXPR
+
+#else
+
+#define ABOUT_RECORD_FIELD_ACCESS(T, object, members)
+#define ABOUT_RECORD_FIELD_ACCESS_IF(record, T, object, members)
+#define ABOUT_PROFILED_CONSTEXPR constexpr
+
+#endif  // ABOUT_PROFILE_FIELD_ACCESS
+
+#ifndef ABOUT_FIELD_NUMBER
+/**
+ * @brief Overrides the protobuf field number of the member variable which follows, e.g.
+ *        <code>ABOUT_FIELD_NUMBER(10) double price;</code>
+ *
+ * Without it, members are numbered from 1, in order of declaration. Code generation defines this macro as an
+ * annotation which it reads; otherwise, it expands to nothing.
+ */
+#define ABOUT_FIELD_NUMBER(number)
+#endif  // ABOUT_FIELD_NUMBER
+
+#ifndef ABOUT_FIELD_RANGE
+/**
+ * @brief Declares the inclusive range of values of the integer member variable which follows, e.g.
+ *        <code>ABOUT_FIELD_RANGE(0, 1000) int quantity;</code>
+ *
+ * Used to choose the bit width of the member in <code>about::bitpack</code>. Like <code>ABOUT_FIELD_NUMBER</code>,
+ * this is read by code generation, and expands to nothing otherwise.
+ */
+#define ABOUT_FIELD_RANGE(min, max)
+#endif  // ABOUT_FIELD_RANGE
+
 namespace about
 {
 
@@ -134,6 +193,17 @@ template <typename T> struct ClassMetaInfo : std::false_type
 template <typename T, typename MemberTag> struct ClassMemberExists : std::false_type
 {};
 
+/**
+ * @brief Returns a <code>std::tuple</code> of lvalue references to all public members, without recording the access
+ *
+ * Used by About utilities in place of <code>get_public_vars</code>, so that field access profiles only count the
+ * accesses made by user code
+ */
+template <typename T> constexpr auto get_public_vars_unrecorded(T&& value)
+{
+  return ClassMetaInfo<cleaned_t<T>>::public_vars(value);
+}
+
 }  // namespace detail
 #endif  // DOXYGEN_SKIP
 
@@ -235,9 +305,21 @@ template <typename ClassT, char... Chars> constexpr bool has(detail::MethodName<
  *
  * @tparam T  type to reflect
  */
-template <typename T> constexpr auto get_public_vars(const T& value)
+template <typename T> ABOUT_PROFILED_CONSTEXPR auto get_public_vars(const T& value)
+{
+  ABOUT_RECORD_FIELD_ACCESS(T, value, detail::all_members_mask<T>());
+  return detail::get_public_vars_unrecorded(value);
+}
+
+/**
+ * @brief Returns a <code>std::tuple</code> of mutable lvalue references to all public members, in order of declaration
+ *
+ * @tparam T  type to reflect
+ */
+template <typename T> ABOUT_PROFILED_CONSTEXPR auto get_public_vars(T& value)
 {
-  return detail::ClassMetaInfo<T>::public_vars(value);
+  ABOUT_RECORD_FIELD_ACCESS(T, value, detail::all_members_mask<T>());
+  return detail::get_public_vars_unrecorded(value);
 }
 
 /**
@@ -281,4 +363,8 @@ template <typename T> using public_var_info_t = typename detail::ClassMetaInfo<d
 
 }  // namespace about
 
+#ifdef ABOUT_PROFILE_FIELD_ACCESS
+#include <about/profile.hpp>
+#endif  // ABOUT_PROFILE_FIELD_ACCESS
+
 #endif  // ABOUT_ABOUT_HPP
\ No newline at end of file
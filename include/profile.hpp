@@ -0,0 +1,379 @@
+/**
+ * @copyright 2022-present Brian Cairl
+ *
+ * @file profile.hpp
+ *
+ * Field access profiler, enabled by defining <code>ABOUT_PROFILE_FIELD_ACCESS</code> for all translation units
+ * (e.g. <code>bazel build --define about_profile=true</code>)
+ */
+#ifndef ABOUT_PROFILE_HPP
+#define ABOUT_PROFILE_HPP
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// About
+#include <about/about.hpp>
+
+namespace about
+{
+
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/**
+ * @brief Access counts of the members of one type, merged over threads
+ */
+struct FieldProfile
+{
+  std::string type_name;
+  std::vector<std::string> member_names;
+  std::vector<std::ptrdiff_t> offsets;
+  std::vector<std::size_t> sizes;
+  std::vector<std::uint64_t> counts;
+
+  /// Number of objects on which both member \c i and \c j were accessed, at <code>i * N + j</code> (for \c i < \c j)
+  std::vector<std::uint64_t> co_access;
+};
+
+/**
+ * @brief Live per-thread access counters of one type
+ */
+class FieldProfileSource
+{
+public:
+  virtual ~FieldProfileSource() = default;
+
+  virtual const char* type_name() const = 0;
+
+  virtual void merge_into(FieldProfile& profile) const = 0;
+};
+
+inline void write_field_profile(std::ostream& os, const std::vector<FieldProfile>& profiles);
+
+/**
+ * @brief Collects counters of all threads; writes a report when the program exits
+ *
+ * The report is written to the file named by the <code>ABOUT_FIELD_PROFILE_OUTPUT</code> environment variable,
+ * or to <code>std::cerr</code>.
+ */
+class FieldProfileRegistry
+{
+public:
+  static FieldProfileRegistry& instance()
+  {
+    static FieldProfileRegistry registry;
+    return registry;
+  }
+
+  void attach(const FieldProfileSource* source)
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    live_.insert(source);
+  }
+
+  void detach(const FieldProfileSource* source)
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    source->merge_into(archived_[source->type_name()]);
+    live_.erase(source);
+  }
+
+  std::vector<FieldProfile> snapshot() const
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    auto merged = archived_;
+    for (const auto* source : live_)
+    {
+      source->merge_into(merged[source->type_name()]);
+    }
+
+    std::vector<FieldProfile> profiles;
+    profiles.reserve(merged.size());
+    for (auto& type_and_profile : merged)
+    {
+      profiles.emplace_back(std::move(type_and_profile.second));
+    }
+    return profiles;
+  }
+
+  ~FieldProfileRegistry()
+  {
+    const auto profiles = snapshot();
+    if (profiles.empty())
+    {
+      return;
+    }
+
+    const char* path = std::getenv("ABOUT_FIELD_PROFILE_OUTPUT");
+    if (path == nullptr)
+    {
+      write_field_profile(std::cerr, profiles);
+      return;
+    }
+    std::ofstream ofs{path};
+    write_field_profile(ofs, profiles);
+  }
+
+private:
+  FieldProfileRegistry() = default;
+
+  mutable std::mutex mutex_;
+  std::map<std::string, FieldProfile> archived_;
+  std::set<const FieldProfileSource*> live_;
+};
+
+/**
+ * @brief Access counters of members of \c T, for one thread
+ *
+ * Counters are only written by their owning thread, but are atomic (with relaxed, non-RMW updates) so that reports
+ * may be taken while threads are running. Members past the 64th are not tracked.
+ */
+template <typename T> class ThreadFieldCounters final : public FieldProfileSource
+{
+public:
+  static constexpr std::size_t kMemberCount = std::tuple_size<public_var_info_t<T>>::value;
+  static constexpr std::size_t kTracked = (kMemberCount < 64) ? kMemberCount : 64;
+
+  ThreadFieldCounters()
+  {
+    for (auto& count : counts_)
+    {
+      count.store(0, std::memory_order_relaxed);
+    }
+    for (auto& count : co_access_)
+    {
+      count.store(0, std::memory_order_relaxed);
+    }
+    FieldProfileRegistry::instance().attach(this);
+  }
+
+  ~ThreadFieldCounters()
+  {
+    flush_window();
+    FieldProfileRegistry::instance().detach(this);
+  }
+
+  void record(const T& object, const std::uint64_t members)
+  {
+    if (!layout_ready_.load(std::memory_order_relaxed))
+    {
+      capture_layout(object, std::make_index_sequence<kTracked>{});
+    }
+    if (std::addressof(object) != last_object_)
+    {
+      flush_window();
+      last_object_ = std::addressof(object);
+    }
+    window_ |= members;
+    for (std::size_t i = 0; i < kTracked; ++i)
+    {
+      if (members & (std::uint64_t{1} << i))
+      {
+        bump(counts_[i]);
+      }
+    }
+  }
+
+  const char* type_name() const override { return ClassMetaInfo<T>::absolute_name; }
+
+  void merge_into(FieldProfile& profile) const override
+  {
+    if (profile.member_names.empty())
+    {
+      profile.type_name = ClassMetaInfo<T>::absolute_name;
+      describe_members(profile, std::make_index_sequence<kTracked>{});
+      profile.offsets.assign(kTracked, -1);
+      profile.counts.assign(kTracked, 0);
+      profile.co_access.assign(kTracked * kTracked, 0);
+    }
+    if (layout_ready_.load(std::memory_order_acquire))
+    {
+      std::copy(offsets_, offsets_ + kTracked, profile.offsets.begin());
+    }
+    for (std::size_t i = 0; i < kTracked; ++i)
+    {
+      profile.counts[i] += counts_[i].load(std::memory_order_relaxed);
+    }
+    for (std::size_t i = 0; i < kTracked * kTracked; ++i)
+    {
+      profile.co_access[i] += co_access_[i].load(std::memory_order_relaxed);
+    }
+  }
+
+private:
+  static void bump(std::atomic<std::uint64_t>& count)
+  {
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  /// Counts pairs of members accessed on the previous object
+  void flush_window()
+  {
+    for (std::size_t i = 0; i < kTracked; ++i)
+    {
+      if ((window_ & (std::uint64_t{1} << i)) == 0)
+      {
+        continue;
+      }
+      for (std::size_t j = i + 1; j < kTracked; ++j)
+      {
+        if (window_ & (std::uint64_t{1} << j))
+        {
+          bump(co_access_[i * kTracked + j]);
+        }
+      }
+    }
+    window_ = 0;
+  }
+
+  template <std::size_t... Is> static void describe_members(FieldProfile& profile, std::index_sequence<Is...> _)
+  {
+    profile.member_names = {std::tuple_element_t<Is, public_var_info_t<T>>::name...};
+    profile.sizes = {sizeof(typename std::tuple_element_t<Is, public_var_info_t<T>>::type)...};
+  }
+
+  template <std::size_t... Is> void capture_layout(const T& object, std::index_sequence<Is...> _)
+  {
+    const auto vars = ClassMetaInfo<T>::public_vars(object);
+    const auto* base = reinterpret_cast<const char*>(std::addressof(object));
+    [[maybe_unused]] const auto __list = std::initializer_list<int>{
+      0, (offsets_[Is] = reinterpret_cast<const char*>(std::addressof(std::get<Is>(vars))) - base, 0)...};
+    layout_ready_.store(true, std::memory_order_release);
+  }
+
+  std::atomic<std::uint64_t> counts_[kTracked + 1];
+  std::atomic<std::uint64_t> co_access_[kTracked * kTracked + 1];
+  std::ptrdiff_t offsets_[kTracked + 1] = {};
+  std::atomic<bool> layout_ready_{false};
+  const void* last_object_ = nullptr;
+  std::uint64_t window_ = 0;
+};
+
+/**
+ * @brief Records that \c members (a bit mask of member indices) of \c object were accessed by this thread
+ */
+template <typename T> void record_field_access(const T& object, const std::uint64_t members)
+{
+  static thread_local ThreadFieldCounters<T> counters;
+  counters.record(object, members);
+}
+
+inline void write_field_profile(std::ostream& os, const std::vector<FieldProfile>& profiles)
+{
+  static constexpr std::size_t kMaxPairs = 10;
+
+  os << "about: field access profile\n";
+  for (const auto& profile : profiles)
+  {
+    const std::size_t n = profile.counts.size();
+    std::uint64_t total = 0;
+    std::vector<std::size_t> ranked(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      ranked[i] = i;
+      total += profile.counts[i];
+    }
+    std::stable_sort(ranked.begin(), ranked.end(), [&profile](const std::size_t lhs, const std::size_t rhs) {
+      return profile.counts[lhs] > profile.counts[rhs];
+    });
+
+    os << '\n' << profile.type_name << " (" << total << " member accesses)\n";
+    os << "  " << std::left << std::setw(24) << "member" << std::right << std::setw(8) << "offset" << std::setw(8)
+       << "size" << std::setw(16) << "accesses" << std::setw(9) << "share" << '\n';
+    for (const auto i : ranked)
+    {
+      const double share = (total == 0) ? 0.0 : (100.0 * static_cast<double>(profile.counts[i]) / static_cast<double>(total));
+      os << "  " << std::left << std::setw(24) << profile.member_names[i] << std::right << std::setw(8);
+      if (profile.offsets[i] < 0)
+      {
+        os << '?';
+      }
+      else
+      {
+        os << profile.offsets[i];
+      }
+      os << std::setw(8) << profile.sizes[i] << std::setw(16) << profile.counts[i] << std::setw(8) << std::fixed
+         << std::setprecision(1) << share << "%\n";
+    }
+
+    std::vector<std::pair<std::uint64_t, std::pair<std::size_t, std::size_t>>> pairs;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      for (std::size_t j = i + 1; j < n; ++j)
+      {
+        if (profile.co_access[i * n + j] != 0)
+        {
+          pairs.emplace_back(profile.co_access[i * n + j], std::make_pair(i, j));
+        }
+      }
+    }
+    std::stable_sort(
+      pairs.begin(), pairs.end(), [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+    if (pairs.size() > kMaxPairs)
+    {
+      pairs.resize(kMaxPairs);
+    }
+
+    if (!pairs.empty())
+    {
+      os << "  co-accessed (objects on which both members were accessed):\n";
+      for (const auto& pair : pairs)
+      {
+        os << "    " << profile.member_names[pair.second.first] << " + " << profile.member_names[pair.second.second]
+           << " : " << pair.first << '\n';
+      }
+    }
+  }
+  os.flush();
+}
+
+/// Bit mask of every tracked member of \c T
+template <typename T> constexpr std::uint64_t all_members_mask()
+{
+  return (std::tuple_size<public_var_info_t<T>>::value >= 64)
+    ? ~std::uint64_t{0}
+    : ((std::uint64_t{1} << std::tuple_size<public_var_info_t<T>>::value) - 1);
+}
+
+/// Bit mask of member \c I of \c T
+template <std::size_t I> constexpr std::uint64_t member_mask() { return (I < 64) ? (std::uint64_t{1} << I) : 0; }
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Writes access counts, gathered so far from all threads, of members of every profiled type
+ *
+ * For each type, members are ranked by number of accesses, with their offset and size, followed by the pairs of
+ * members most often accessed on the same object (consecutively, by the same thread). Members which are rarely
+ * accessed, or rarely accessed with the hottest members, are candidates to be moved or split out.
+ *
+ * The same report is written automatically when the program exits.
+ */
+inline void write_field_access_report(std::ostream& os)
+{
+  detail::write_field_profile(os, detail::FieldProfileRegistry::instance().snapshot());
+}
+
+}  // namespace about
+
+#endif  // ABOUT_PROFILE_HPP
@@ -0,0 +1,476 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_AGGREGATE_HPP
+#define ABOUT_AGGREGATE_HPP
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// About
+#include <about/about.hpp>
+#include <about/flatten.hpp>
+#include <about/integer_sequence.hpp>
+#include <about/parallel.hpp>
+#include <about/var.hpp>
+
+namespace about
+{
+
+/**
+ * @brief Statistics of one arithmetic member over a collection of records
+ *
+ * Values are accumulated as \c double; integers beyond 2^53 in magnitude lose precision.
+ */
+struct field_stats
+{
+  std::size_t count;
+  double sum;
+  double min;
+  double max;
+  double mean;
+};
+
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+template <> struct ClassMetaInfo<::about::field_stats>
+{
+  static constexpr const char* name = "field_stats";
+  static constexpr const char* absolute_name = "about::field_stats";
+
+  struct MemberInfo__field_stats__count
+  {
+    using type = std::size_t;
+    static constexpr const char* name = "count";
+  };
+
+  struct MemberInfo__field_stats__sum
+  {
+    using type = double;
+    static constexpr const char* name = "sum";
+  };
+
+  struct MemberInfo__field_stats__min
+  {
+    using type = double;
+    static constexpr const char* name = "min";
+  };
+
+  struct MemberInfo__field_stats__max
+  {
+    using type = double;
+    static constexpr const char* name = "max";
+  };
+
+  struct MemberInfo__field_stats__mean
+  {
+    using type = double;
+    static constexpr const char* name = "mean";
+  };
+
+  using public_var_info = std::tuple<
+    MemberInfo__field_stats__count,
+    MemberInfo__field_stats__sum,
+    MemberInfo__field_stats__min,
+    MemberInfo__field_stats__max,
+    MemberInfo__field_stats__mean>;
+
+  static constexpr decltype(auto) public_vars(::about::field_stats& v)
+  {
+    return std::tie(v.count, v.sum, v.min, v.max, v.mean);
+  }
+
+  static constexpr decltype(auto) public_vars(const ::about::field_stats& v)
+  {
+    return std::tie(v.count, v.sum, v.min, v.max, v.mean);
+  }
+};
+
+template <> struct ClassMemberExists<::about::field_stats, decltype("count"_var)> : std::true_type
+{};
+template <> struct ClassMemberExists<::about::field_stats, decltype("sum"_var)> : std::true_type
+{};
+template <> struct ClassMemberExists<::about::field_stats, decltype("min"_var)> : std::true_type
+{};
+template <> struct ClassMemberExists<::about::field_stats, decltype("max"_var)> : std::true_type
+{};
+template <> struct ClassMemberExists<::about::field_stats, decltype("mean"_var)> : std::true_type
+{};
+
+template <typename LeafT>
+struct IsAggregatedLeaf
+    : std::integral_constant<bool, std::is_arithmetic<LeafT>::value && !std::is_same<LeafT, bool>::value>
+{};
+
+/**
+ * @brief Which leaves of a tuple of leaf types are aggregated, and where their statistics are stored
+ */
+template <typename LeafTupleT> struct AggregatedLeaves;
+
+template <typename... LeafTs> struct AggregatedLeaves<std::tuple<LeafTs...>>
+{
+  static constexpr std::size_t count =
+    partial_sum({static_cast<std::size_t>(IsAggregatedLeaf<LeafTs>::value)...}, sizeof...(LeafTs));
+
+  /// Leaf \c i is aggregated
+  static constexpr bool aggregated(const std::size_t i)
+  {
+    return std::initializer_list<bool>{IsAggregatedLeaf<LeafTs>::value...}.begin()[i];
+  }
+
+  /// Position of statistics of leaf \c i among statistics of all aggregated leaves
+  static constexpr std::size_t slot(const std::size_t i)
+  {
+    return partial_sum({static_cast<std::size_t>(IsAggregatedLeaf<LeafTs>::value)...}, i);
+  }
+};
+
+/**
+ * @brief Running statistics, kept in independent lanes so that accumulation loops are vectorized
+ */
+struct StatsAccumulator
+{
+  static constexpr std::size_t kLanes = 8;
+
+  double sum[kLanes];
+  double min[kLanes];
+  double max[kLanes];
+  std::size_t count = 0;
+
+  StatsAccumulator()
+  {
+    std::fill(sum, sum + kLanes, 0.0);
+    std::fill(min, min + kLanes, std::numeric_limits<double>::infinity());
+    std::fill(max, max + kLanes, -std::numeric_limits<double>::infinity());
+  }
+
+  template <typename ValueT> void add(const ValueT* values, const std::size_t n)
+  {
+    std::size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes)
+    {
+      for (std::size_t j = 0; j < kLanes; ++j)
+      {
+        const double v = static_cast<double>(values[i + j]);
+        sum[j] += v;
+        min[j] = (v < min[j]) ? v : min[j];
+        max[j] = (v > max[j]) ? v : max[j];
+      }
+    }
+    for (; i < n; ++i)
+    {
+      const double v = static_cast<double>(values[i]);
+      sum[0] += v;
+      min[0] = (v < min[0]) ? v : min[0];
+      max[0] = (v > max[0]) ? v : max[0];
+    }
+    count += n;
+  }
+
+  void merge(const StatsAccumulator& other)
+  {
+    for (std::size_t j = 0; j < kLanes; ++j)
+    {
+      sum[j] += other.sum[j];
+      min[j] = std::min(min[j], other.min[j]);
+      max[j] = std::max(max[j], other.max[j]);
+    }
+    count += other.count;
+  }
+
+  field_stats finish() const
+  {
+    if (count == 0)
+    {
+      return field_stats{0, 0.0, 0.0, 0.0, 0.0};
+    }
+    field_stats stats{count, 0.0, min[0], max[0], 0.0};
+    for (std::size_t j = 0; j < kLanes; ++j)
+    {
+      stats.sum += sum[j];
+      stats.min = std::min(stats.min, min[j]);
+      stats.max = std::max(stats.max, max[j]);
+    }
+    stats.mean = stats.sum / static_cast<double>(count);
+    return stats;
+  }
+};
+
+/// Number of records gathered into contiguous per-leaf buffers at a time
+static constexpr std::size_t kAggregateBlockSize = 256;
+
+template <std::size_t I, typename T>
+void accumulate_leaf(const T* records, const std::size_t n, StatsAccumulator* stats, std::false_type _)
+{}
+
+template <std::size_t I, typename T>
+void accumulate_leaf(const T* records, const std::size_t n, StatsAccumulator* stats, std::true_type _)
+{
+  using LeafT = std::tuple_element_t<I, leaf_types_t<T>>;
+  LeafT buffer[kAggregateBlockSize];
+  for (std::size_t r = 0; r < n; ++r)
+  {
+    buffer[r] = ::about::detail::get_leaf_unrecorded<I>(records[r]);
+  }
+  stats[AggregatedLeaves<leaf_types_t<T>>::slot(I)].add(buffer, n);
+}
+
+/**
+ * @brief Accumulates statistics of records, one cache-resident block at a time
+ *
+ * Each leaf of a block is gathered (a strided load) into a contiguous buffer, then accumulated.
+ */
+template <typename T, std::size_t... Is>
+void accumulate_records(const T* records, const std::size_t n, StatsAccumulator* stats, index_sequence<Is...> _)
+{
+  using Aggregated = AggregatedLeaves<leaf_types_t<T>>;
+  for (std::size_t first = 0; first < n; first += kAggregateBlockSize)
+  {
+    const std::size_t block = std::min(kAggregateBlockSize, n - first);
+    [[maybe_unused]] const auto __list = std::initializer_list<int>{
+      0,
+      (accumulate_leaf<Is>(records + first, block, stats, std::integral_constant<bool, Aggregated::aggregated(Is)>{}),
+       0)...};
+  }
+}
+
+template <std::size_t I, typename ColumnsT>
+void accumulate_column(
+  const ColumnsT& columns,
+  const std::size_t first,
+  const std::size_t last,
+  StatsAccumulator* stats,
+  std::false_type _)
+{}
+
+template <std::size_t I, typename ColumnsT>
+void accumulate_column(
+  const ColumnsT& columns,
+  const std::size_t first,
+  const std::size_t last,
+  StatsAccumulator* stats,
+  std::true_type _)
+{
+  const auto& column = std::get<I>(columns);
+  const std::size_t column_last = std::min(last, column.size());
+  if (first < column_last)
+  {
+    stats->add(column.data() + first, column_last - first);
+  }
+}
+
+template <typename T, std::size_t... Is>
+void accumulate_columns(
+  const leaf_vectors_t<T>& columns,
+  const std::size_t first,
+  const std::size_t last,
+  StatsAccumulator* stats,
+  index_sequence<Is...> _)
+{
+  using Aggregated = AggregatedLeaves<leaf_types_t<T>>;
+  [[maybe_unused]] const auto __list = std::initializer_list<int>{
+    0,
+    (accumulate_column<Is>(
+       columns, first, last, stats + Aggregated::slot(Is), std::integral_constant<bool, Aggregated::aggregated(Is)>{}),
+     0)...};
+}
+
+/**
+ * @brief Splits <code>[0, n)</code> across threads, runs <code>accumulate(first, last, stats)</code> on each part,
+ *        and merges results
+ */
+template <std::size_t FieldCount, typename AccumulateT>
+std::vector<field_stats> accumulate_parallel(const std::size_t n, const std::size_t thread_count, AccumulateT&& accumulate)
+{
+  const std::size_t chunk = (n + thread_count - 1) / thread_count;
+  std::vector<std::vector<StatsAccumulator>> partial(thread_count, std::vector<StatsAccumulator>(FieldCount));
+  run_parallel(thread_count, [&](const std::size_t t) {
+    const std::size_t first = std::min(n, t * chunk);
+    const std::size_t last = std::min(n, first + chunk);
+    accumulate(first, last, partial[t].data());
+  });
+
+  std::vector<field_stats> stats;
+  stats.reserve(FieldCount);
+  for (std::size_t f = 0; f < FieldCount; ++f)
+  {
+    for (std::size_t t = 1; t < thread_count; ++t)
+    {
+      partial[0][f].merge(partial[t][f]);
+    }
+    stats.push_back(partial[0][f].finish());
+  }
+  return stats;
+}
+
+template <typename T, std::size_t... Is> bool same_column_sizes(const leaf_vectors_t<T>& columns, index_sequence<Is...> _)
+{
+  const std::size_t n = std::get<0>(columns).size();
+  bool same = true;
+  [[maybe_unused]] const auto __list =
+    std::initializer_list<int>{0, (same = same && (std::get<Is>(columns).size() == n), 0)...};
+  return same;
+}
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Per-member statistics of a collection of \c T, one <code>field_stats</code> per arithmetic leaf member
+ *
+ * Statistics are in order of <code>leaf_names<T>()</code>, skipping non-arithmetic (and \c bool) leaves.
+ */
+template <typename T> class aggregate_result
+{
+public:
+  /// Number of aggregated members
+  static constexpr std::size_t size = detail::AggregatedLeaves<leaf_types_t<T>>::count;
+
+  explicit aggregate_result(std::vector<field_stats> stats) : stats_{std::move(stats)} {}
+
+  /**
+   * @brief Returns names of aggregated members, as in <code>leaf_names<T>()</code>
+   */
+  static const std::vector<std::string>& names()
+  {
+    static const std::vector<std::string> kNames = aggregated_names();
+    return kNames;
+  }
+
+  /**
+   * @brief Returns statistics of the \c i th aggregated member
+   */
+  const field_stats& operator[](const std::size_t i) const { return stats_[i]; }
+
+  /**
+   * @brief Returns statistics of the member with flattened name \c name, e.g. <code>"d.a.real_number"</code>
+   *
+   * @throws std::out_of_range  if no aggregated member has this name
+   */
+  const field_stats& at(const std::string& name) const
+  {
+    const auto& all = names();
+    const auto itr = std::find(all.begin(), all.end(), name);
+    if (itr == all.end())
+    {
+      throw std::out_of_range{"aggregate_result: no aggregated member named " + name};
+    }
+    return stats_[static_cast<std::size_t>(itr - all.begin())];
+  }
+
+  /**
+   * @brief Returns statistics of a member named by tag, e.g. <code>"price"_var</code> or
+   *        <code>"scale.real_number"_var</code>
+   *
+   * The member is resolved at compile-time; naming a member which is not an aggregated leaf is a compile error.
+   */
+  template <char... Chars> const field_stats& get(detail::VarName<Chars...> tag) const
+  {
+    using Aggregated = detail::AggregatedLeaves<leaf_types_t<T>>;
+    constexpr std::size_t kLeaf = leaf_index<T>(tag);
+    static_assert(Aggregated::aggregated(kLeaf), "member is not aggregated (not an arithmetic, non-bool leaf)");
+    return stats_[Aggregated::slot(kLeaf)];
+  }
+
+private:
+  static std::vector<std::string> aggregated_names()
+  {
+    using Aggregated = detail::AggregatedLeaves<leaf_types_t<T>>;
+    const auto all = leaf_names<T>();
+    std::vector<std::string> aggregated;
+    aggregated.reserve(size);
+    for (std::size_t i = 0; i < all.size(); ++i)
+    {
+      if (Aggregated::aggregated(i))
+      {
+        aggregated.push_back(all[i]);
+      }
+    }
+    return aggregated;
+  }
+
+  std::vector<field_stats> stats_;
+};
+
+template <typename T> constexpr std::size_t aggregate_result<T>::size;
+
+/**
+ * @brief Minimum number of records handled by each thread of <code>aggregate</code>
+ */
+static constexpr std::size_t aggregate_records_per_thread = 1UL << 16;
+
+/**
+ * @brief Computes count, sum, min, max and mean of every arithmetic leaf member of \c n records, in one pass
+ *
+ * Records are processed in blocks small enough to remain in cache; each arithmetic leaf of a block is gathered into a
+ * contiguous buffer, then accumulated in vectorizable lanes. Large inputs are split across threads.
+ *
+ * @code{.cpp}
+ * const auto stats = about::aggregate(poses);
+ * std::cout << about::fmt(stats.get("x"_var)) << std::endl;
+ * @endcode
+ */
+template <typename T> aggregate_result<T> aggregate(const T* data, const std::size_t n)
+{
+  static_assert(is_reflected_class<T>, "aggregate requires a reflected class type");
+  static constexpr std::size_t kFieldCount = aggregate_result<T>::size;
+  return aggregate_result<T>{detail::accumulate_parallel<kFieldCount>(
+    n,
+    detail::parallel_thread_count(n, aggregate_records_per_thread),
+    [data](const std::size_t first, const std::size_t last, detail::StatsAccumulator* stats) {
+      detail::accumulate_records(data + first, last - first, stats, make_index_sequence<leaf_count<T>>{});
+    })};
+}
+
+/**
+ * @copydoc aggregate
+ */
+template <typename T, typename AllocatorT> aggregate_result<T> aggregate(const std::vector<T, AllocatorT>& data)
+{
+  return aggregate(data.data(), data.size());
+}
+
+/**
+ * @brief Computes statistics of every arithmetic column of records stored in structure-of-arrays layout
+ *
+ * Columns are contiguous, so they are accumulated without gathering.
+ *
+ * @code{.cpp}
+ * const auto columns = about::csv::read_columns<Pose>(text.data(), text.size());
+ * const auto stats = about::aggregate<Pose>(columns);
+ * @endcode
+ *
+ * @throws std::invalid_argument  if columns are not all the same size
+ */
+template <typename T> aggregate_result<T> aggregate(const leaf_vectors_t<T>& columns)
+{
+  static_assert(is_reflected_class<T>, "aggregate requires a reflected class type");
+  static constexpr std::size_t kFieldCount = aggregate_result<T>::size;
+  if (!detail::same_column_sizes<T>(columns, make_index_sequence<leaf_count<T>>{}))
+  {
+    throw std::invalid_argument{"aggregate: columns have different sizes"};
+  }
+  const std::size_t n = std::get<0>(columns).size();
+  return aggregate_result<T>{detail::accumulate_parallel<kFieldCount>(
+    n,
+    detail::parallel_thread_count(n, aggregate_records_per_thread),
+    [&columns](const std::size_t first, const std::size_t last, detail::StatsAccumulator* stats) {
+      detail::accumulate_columns<T>(columns, first, last, stats, make_index_sequence<leaf_count<T>>{});
+    })};
+}
+
+}  // namespace about
+
+#endif  // ABOUT_AGGREGATE_HPP
@@ -0,0 +1,340 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_ASYNC_LOG_HPP
+#define ABOUT_ASYNC_LOG_HPP
+
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// POSIX
+#include <stdlib.h>
+
+// About
+#include <about/about.hpp>
+#include <about/filter.hpp>
+#include <about/fmt.hpp>
+#include <about/for_each.hpp>
+#include <about/integer_sequence.hpp>
+
+namespace about
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+template <typename InfoT> struct IsTriviallyCopyableMember : std::is_trivially_copyable<typename InfoT::type>
+{};
+
+/// Index of \c T within a <code>std::tuple</code> of types
+template <typename T, typename TupleT> struct TupleIndex;
+
+template <typename T, typename... OtherTs> struct TupleIndex<T, std::tuple<T, OtherTs...>>
+{
+  static constexpr std::size_t value = 0;
+};
+
+template <typename T, typename U, typename... OtherTs> struct TupleIndex<T, std::tuple<U, OtherTs...>>
+{
+  static constexpr std::size_t value = 1 + TupleIndex<T, std::tuple<OtherTs...>>::value;
+};
+
+/**
+ * @brief Copies of all trivially-copyable public members of \c T, used when \c T itself cannot be copied cheaply
+ */
+template <typename T, typename InfoTupleT = filter_t<IsTriviallyCopyableMember, public_var_info_t<T>>>
+struct MemberSnapshot;
+
+template <typename T, typename... InfoTs> struct MemberSnapshot<T, std::tuple<InfoTs...>>
+{
+  explicit MemberSnapshot(const T& value) :
+      values{
+        std::get<TupleIndex<InfoTs, public_var_info_t<T>>::value>(::about::detail::get_public_vars_unrecorded(value))...}
+  {}
+
+  std::tuple<typename InfoTs::type...> values;
+};
+
+template <typename T, typename... InfoTs>
+void print_snapshot(std::ostream& os, const MemberSnapshot<T, std::tuple<InfoTs...>>& snapshot)
+{
+  static constexpr std::size_t Justification = 4UL;
+  os << "{\n";
+  ::about::for_each_enumerated(Printer<Justification>{os, Justification}, std::tuple<InfoTs...>{}, snapshot.values);
+  os << "\n}";
+}
+
+template <typename T> void print_snapshot(std::ostream& os, const MemberSnapshot<T, std::tuple<>>& snapshot)
+{
+  os << "{}";
+}
+
+template <typename T> struct AsyncLogPayload
+{
+  using type = typename std::conditional<std::is_trivially_copyable<T>::value, T, MemberSnapshot<T>>::type;
+};
+
+template <typename T> void async_log_print(std::ostream& os, const T& payload, std::true_type _)
+{
+  fmt_print<4UL>(os, payload);
+}
+
+template <typename T> void async_log_print(std::ostream& os, const MemberSnapshot<T>& payload, std::false_type _)
+{
+  print_snapshot(os, payload);
+}
+
+/**
+ * @brief Type-erased description of a logged record, shared by all records of the same type
+ */
+struct AsyncLogDescriptor
+{
+  /// Type name, as reported by <code>nameof</code>
+  const char* name;
+
+  /// Formats the payload stored at \c storage, then destroys it
+  void (*consume)(std::ostream& os, void* storage);
+};
+
+template <typename T> struct AsyncLogDescriptorFor
+{
+  using payload_type = typename AsyncLogPayload<T>::type;
+
+  static void consume(std::ostream& os, void* storage)
+  {
+    auto* const payload = static_cast<payload_type*>(storage);
+    async_log_print<T>(os, *payload, std::is_trivially_copyable<T>{});
+    payload->~payload_type();
+  }
+
+  static constexpr AsyncLogDescriptor value{ClassMetaInfo<T>::name, &consume};
+};
+
+template <typename T> constexpr AsyncLogDescriptor AsyncLogDescriptorFor<T>::value;
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Moves formatting of reflected objects off of latency-critical threads
+ *
+ * <code>log</code> copies an object into a pre-allocated slot of a bounded, lock-free, multi-producer ring buffer,
+ * along with a pointer to a static descriptor of its type. A background thread formats queued records to an
+ * <code>std::ostream</code> using <code>about::fmt</code>.
+ *
+ * Trivially-copyable objects are copied whole. Otherwise, only their trivially-copyable public members are copied,
+ * and only those members are printed. Either way, enqueuing never allocates.
+ *
+ * @code{.cpp}
+ * about::async_log<> logger{std::cout};
+ * logger.log(obj);  // returns false, and counts a drop, if the ring is full
+ * @endcode
+ *
+ * @tparam PayloadSize  maximum size of a copied object, in bytes
+ */
+template <std::size_t PayloadSize = 240UL> class async_log
+{
+public:
+  /**
+   * @param os  stream which records are formatted to, from the background thread only
+   * @param capacity  number of slots in the ring; rounded up to a power of two
+   * @param idle_sleep  how long the background thread sleeps when there is nothing to format
+   */
+  explicit async_log(
+    std::ostream& os,
+    const std::size_t capacity = 1024UL,
+    const std::chrono::microseconds idle_sleep = std::chrono::microseconds{50}) :
+      os_{std::addressof(os)},
+      mask_{round_up_pow2(capacity) - 1},
+      slots_{allocate_slots(mask_ + 1)},
+      idle_sleep_{idle_sleep}
+  {
+    worker_ = std::thread{[this] { run(); }};
+  }
+
+  async_log(const async_log&) = delete;
+  async_log& operator=(const async_log&) = delete;
+
+  /**
+   * @brief Formats all queued records, then stops the background thread
+   */
+  ~async_log()
+  {
+    stop_.store(true, std::memory_order_release);
+    worker_.join();
+  }
+
+  /**
+   * @brief Enqueues a copy of \c value for formatting
+   *
+   * Wait-free with respect to the background thread; lock-free with respect to other producers.
+   *
+   * @return \c false if the ring is full, in which case \c value is dropped
+   */
+  template <typename T> bool log(const T& value)
+  {
+    static_assert(has_reflection_info<T> && std::is_class<T>::value, "async_log requires a reflected class type");
+
+    using payload_type = typename detail::AsyncLogPayload<T>::type;
+    static_assert(sizeof(payload_type) <= PayloadSize, "type is too large for async_log slot; increase PayloadSize");
+    static_assert(alignof(payload_type) <= alignof(std::max_align_t), "type is over-aligned for async_log slot");
+
+    std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    while (true)
+    {
+      Slot& slot = slots_[pos & mask_];
+      const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0)
+      {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          new (slot.storage) payload_type(value);
+          slot.descriptor = std::addressof(detail::AsyncLogDescriptorFor<T>::value);
+          slot.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0)
+      {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      else
+      {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief Blocks until every record enqueued before this call has been formatted
+   */
+  void flush() const
+  {
+    const std::size_t target = enqueue_pos_.load(std::memory_order_acquire);
+    while (consumed_.load(std::memory_order_acquire) < target)
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  /**
+   * @brief Returns number of records dropped because the ring was full
+   */
+  std::size_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Returns number of slots in the ring
+   */
+  std::size_t capacity() const { return mask_ + 1; }
+
+private:
+  struct alignas(64) Slot
+  {
+    std::atomic<std::size_t> sequence;
+    const detail::AsyncLogDescriptor* descriptor;
+    alignas(std::max_align_t) unsigned char storage[PayloadSize];
+  };
+
+  static_assert(std::is_trivially_destructible<Slot>::value, "async_log slots are released without destruction");
+
+  struct SlotDeleter
+  {
+    void operator()(Slot* const slots) const { std::free(slots); }
+  };
+
+  /// Allocates ring with every slot on its own cache line; <code>std::allocator</code> ignores over-alignment
+  static std::unique_ptr<Slot[], SlotDeleter> allocate_slots(const std::size_t count)
+  {
+    void* memory = nullptr;
+    if (::posix_memalign(&memory, alignof(Slot), count * sizeof(Slot)) != 0)
+    {
+      throw std::bad_alloc{};
+    }
+    std::unique_ptr<Slot[], SlotDeleter> slots{static_cast<Slot*>(memory)};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      new (slots.get() + i) Slot;
+      slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    return slots;
+  }
+
+  static std::size_t round_up_pow2(const std::size_t n)
+  {
+    std::size_t p = 1;
+    while (p < n)
+    {
+      p <<= 1;
+    }
+    return p;
+  }
+
+  /// Formats at most one record; returns \c false if none was available
+  bool consume_one()
+  {
+    Slot& slot = slots_[dequeue_pos_ & mask_];
+    if (slot.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1)
+    {
+      return false;
+    }
+
+    (*os_) << slot.descriptor->name << ' ';
+    slot.descriptor->consume(*os_, slot.storage);
+    (*os_) << '\n';
+
+    slot.sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+    ++dequeue_pos_;
+    consumed_.store(dequeue_pos_, std::memory_order_release);
+    return true;
+  }
+
+  void run()
+  {
+    while (true)
+    {
+      if (consume_one())
+      {
+        continue;
+      }
+      if (stop_.load(std::memory_order_acquire))
+      {
+        // Drain records which were fully published before stop was requested
+        while (consume_one())
+        {}
+        break;
+      }
+      os_->flush();
+      std::this_thread::sleep_for(idle_sleep_);
+    }
+    os_->flush();
+  }
+
+  std::ostream* os_;
+  std::size_t mask_;
+  std::unique_ptr<Slot[], SlotDeleter> slots_;
+  std::chrono::microseconds idle_sleep_;
+
+  alignas(64) std::atomic<std::size_t> enqueue_pos_{0};
+  alignas(64) std::size_t dequeue_pos_ = 0;
+  alignas(64) std::atomic<std::size_t> consumed_{0};
+  std::atomic<std::size_t> dropped_{0};
+  std::atomic<bool> stop_{false};
+  std::thread worker_;
+};
+
+}  // namespace about
+
+#endif  // ABOUT_ASYNC_LOG_HPP
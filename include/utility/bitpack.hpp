@@ -0,0 +1,412 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_BITPACK_HPP
+#define ABOUT_BITPACK_HPP
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// About
+#include <about/about.hpp>
+#include <about/flatten.hpp>
+#include <about/integer_sequence.hpp>
+
+namespace about
+{
+namespace bitpack
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+template <typename... Ts> struct MakeVoid
+{
+  using type = void;
+};
+
+/// Number of bits needed to represent every value in <code>[0, span]</code>
+constexpr std::size_t bits_for(std::uint64_t span)
+{
+  std::size_t n = 0;
+  while (span != 0)
+  {
+    ++n;
+    span >>= 1;
+  }
+  return n;
+}
+
+/// Range between smallest and largest enumerator of an enum with generated meta information
+template <typename InfoT, typename Enable = void> struct EnumRange : std::false_type
+{};
+
+template <typename InfoT>
+struct EnumRange<
+  InfoT,
+  typename MakeVoid<decltype(::about::detail::ClassMetaInfo<typename InfoT::type>::min_value)>::type>
+    : std::is_enum<typename InfoT::type>
+{
+  static constexpr long long min = ::about::detail::ClassMetaInfo<typename InfoT::type>::min_value;
+  static constexpr long long max = ::about::detail::ClassMetaInfo<typename InfoT::type>::max_value;
+};
+
+/// Range of a member declared with <code>ABOUT_FIELD_RANGE</code>, falling back to its enumerator range
+template <typename InfoT, typename Enable = void> struct LeafRange : EnumRange<InfoT>
+{};
+
+template <typename InfoT>
+struct LeafRange<InfoT, typename MakeVoid<decltype(InfoT::range_min), decltype(InfoT::range_max)>::type>
+    : std::true_type
+{
+  static constexpr long long min = InfoT::range_min;
+  static constexpr long long max = InfoT::range_max;
+};
+
+template <typename T> struct AlwaysFalse : std::false_type
+{};
+
+template <typename T, typename Enable = void> struct IntegerOf
+{
+  using type = T;
+};
+
+template <typename T> struct IntegerOf<T, std::enable_if_t<std::is_enum<T>::value>>
+{
+  using type = std::underlying_type_t<T>;
+};
+
+template <typename T> constexpr bool is_bool = std::is_same<T, bool>::value;
+
+template <typename T>
+constexpr bool is_integer = (std::is_integral<T>::value && !is_bool<T>) || std::is_enum<T>::value;
+
+template <typename InfoT, typename Enable = void> struct LeafBits
+{
+  static_assert(AlwaysFalse<InfoT>::value, "member type can not be bit-packed");
+};
+
+template <typename InfoT> struct LeafBits<InfoT, std::enable_if_t<is_bool<typename InfoT::type>>>
+{
+  static constexpr std::size_t width = 1;
+
+  static constexpr bool valid(const bool value) { return true; }
+
+  static std::uint64_t to_bits(const bool value) { return static_cast<std::uint64_t>(value); }
+
+  static bool from_bits(const std::uint64_t bits) { return bits != 0; }
+};
+
+/// Integers and enums with a declared range are stored as an offset from the smallest value
+template <typename InfoT>
+struct LeafBits<InfoT, std::enable_if_t<is_integer<typename InfoT::type> && LeafRange<InfoT>::value>>
+{
+  using T = typename InfoT::type;
+  using IntT = typename IntegerOf<T>::type;
+
+  static constexpr long long min = LeafRange<InfoT>::min;
+  static constexpr long long max = LeafRange<InfoT>::max;
+  static_assert(min <= max, "empty member range");
+
+  static constexpr std::size_t width = bits_for(static_cast<std::uint64_t>(max) - static_cast<std::uint64_t>(min));
+
+  static bool valid(const T value)
+  {
+    const auto raw = static_cast<IntT>(value);
+    if (std::is_unsigned<IntT>::value &&
+        static_cast<std::uint64_t>(raw) > static_cast<std::uint64_t>(std::numeric_limits<long long>::max()))
+    {
+      return false;
+    }
+    const auto v = static_cast<long long>(raw);
+    return min <= v && v <= max;
+  }
+
+  static std::uint64_t to_bits(const T value)
+  {
+    return static_cast<std::uint64_t>(static_cast<long long>(static_cast<IntT>(value))) -
+      static_cast<std::uint64_t>(min);
+  }
+
+  static T from_bits(const std::uint64_t bits)
+  {
+    return static_cast<T>(static_cast<IntT>(static_cast<long long>(bits + static_cast<std::uint64_t>(min))));
+  }
+};
+
+/// Integers and enums without a declared range are stored at full width
+template <typename InfoT>
+struct LeafBits<InfoT, std::enable_if_t<is_integer<typename InfoT::type> && !LeafRange<InfoT>::value>>
+{
+  using T = typename InfoT::type;
+  using IntT = typename IntegerOf<T>::type;
+  using UIntT = std::make_unsigned_t<IntT>;
+
+  static constexpr std::size_t width = sizeof(IntT) * 8;
+
+  static constexpr bool valid(const T value) { return true; }
+
+  static std::uint64_t to_bits(const T value) { return static_cast<UIntT>(static_cast<IntT>(value)); }
+
+  static T from_bits(const std::uint64_t bits) { return static_cast<T>(static_cast<IntT>(static_cast<UIntT>(bits))); }
+};
+
+template <typename InfoT> struct LeafBits<InfoT, std::enable_if_t<std::is_floating_point<typename InfoT::type>::value>>
+{
+  using T = typename InfoT::type;
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8, "floating point type can not be bit-packed");
+  using UIntT = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+  static constexpr std::size_t width = sizeof(T) * 8;
+
+  static constexpr bool valid(const T value) { return true; }
+
+  static std::uint64_t to_bits(const T value)
+  {
+    UIntT bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+  static T from_bits(const std::uint64_t bits)
+  {
+    const auto narrow = static_cast<UIntT>(bits);
+    T value;
+    std::memcpy(&value, &narrow, sizeof(value));
+    return value;
+  }
+};
+
+/**
+ * @brief Member information of all leaf members, depth-first, in order of declaration (as <code>leaf_types_t</code>)
+ */
+template <typename InfoT, typename Enable = void> struct InfoLeaves
+{
+  using type = std::tuple<InfoT>;
+};
+
+template <typename InfoTupleT> struct MemberInfoLeaves;
+
+template <typename... InfoTs> struct MemberInfoLeaves<std::tuple<InfoTs...>>
+{
+  using type = decltype(std::tuple_cat(std::declval<typename InfoLeaves<InfoTs>::type>()...));
+};
+
+template <typename InfoT> struct InfoLeaves<InfoT, std::enable_if_t<is_reflected_class<typename InfoT::type>>>
+{
+  using type = typename MemberInfoLeaves<public_var_info_t<typename InfoT::type>>::type;
+};
+
+template <typename T, std::size_t I>
+using LeafBitsOf = LeafBits<std::tuple_element_t<I, typename MemberInfoLeaves<public_var_info_t<T>>::type>>;
+
+template <typename T, std::size_t... Is> constexpr std::size_t bit_offset(const std::size_t i, index_sequence<Is...> _)
+{
+  return ::about::detail::partial_sum({LeafBitsOf<T, Is>::width...}, i);
+}
+
+template <typename T, std::size_t I> struct LeafOffset
+{
+  static constexpr std::size_t value = bit_offset<T>(I, make_index_sequence<leaf_count<T>>{});
+};
+
+/**
+ * @brief Reads and writes \c Width bits at bit \c Offset of an array of words
+ *
+ * Position is known at compile time, so whether a field spans two words is resolved without branches.
+ */
+template <std::size_t Offset, std::size_t Width> struct BitField
+{
+  static constexpr std::size_t word = Offset / 64;
+  static constexpr std::size_t shift = Offset % 64;
+  static constexpr std::uint64_t mask = (Width >= 64) ? ~std::uint64_t{0} : ((std::uint64_t{1} << Width) - 1);
+  using Spans = std::integral_constant<bool, (shift + Width > 64)>;
+  using Empty = std::integral_constant<bool, (Width == 0)>;
+
+  static void write(std::uint64_t* words, const std::uint64_t bits) { write(words, bits & mask, Empty{}); }
+
+  static std::uint64_t read(const std::uint64_t* words) { return read(words, Empty{}); }
+
+private:
+  static void write(std::uint64_t* words, const std::uint64_t bits, std::true_type _) {}
+
+  static void write(std::uint64_t* words, const std::uint64_t bits, std::false_type _)
+  {
+    words[word] |= bits << shift;
+    write_high(words, bits, Spans{});
+  }
+
+  static void write_high(std::uint64_t* words, const std::uint64_t bits, std::false_type _) {}
+
+  static void write_high(std::uint64_t* words, const std::uint64_t bits, std::true_type _)
+  {
+    words[word + 1] |= bits >> (64 - shift);
+  }
+
+  static std::uint64_t read(const std::uint64_t* words, std::true_type _) { return 0; }
+
+  static std::uint64_t read(const std::uint64_t* words, std::false_type _)
+  {
+    return ((words[word] >> shift) | read_high(words, Spans{})) & mask;
+  }
+
+  static std::uint64_t read_high(const std::uint64_t* words, std::false_type _) { return 0; }
+
+  static std::uint64_t read_high(const std::uint64_t* words, std::true_type _)
+  {
+    return words[word + 1] << (64 - shift);
+  }
+};
+
+template <typename T, std::size_t I> using LeafField = BitField<LeafOffset<T, I>::value, LeafBitsOf<T, I>::width>;
+
+template <typename T, std::size_t I> void write_leaf(const T& value, std::uint64_t* words)
+{
+  using Leaf = LeafBitsOf<T, I>;
+  const auto& leaf = ::about::detail::get_leaf_unrecorded<I>(value);
+  if (!Leaf::valid(leaf))
+  {
+    throw std::out_of_range{"bitpack: value of " + leaf_names<T>()[I] + " is outside of its declared range"};
+  }
+  LeafField<T, I>::write(words, Leaf::to_bits(leaf));
+}
+
+template <typename T, std::size_t... Is> void write_leaves(const T& value, std::uint64_t* words, index_sequence<Is...> _)
+{
+  [[maybe_unused]] const auto __list = std::initializer_list<int>{0, (write_leaf<T, Is>(value, words), 0)...};
+}
+
+template <typename T, std::size_t... Is> void read_leaves(const std::uint64_t* words, T& value, index_sequence<Is...> _)
+{
+  [[maybe_unused]] const auto __list = std::initializer_list<int>{
+    0,
+    (::about::detail::get_leaf_unrecorded<Is>(value) = LeafBitsOf<T, Is>::from_bits(LeafField<T, Is>::read(words)),
+     0)...};
+}
+
+template <typename T, std::size_t... Is> constexpr std::size_t total_bits(index_sequence<Is...> _)
+{
+  return ::about::detail::partial_sum({LeafBitsOf<T, Is>::width...}, sizeof...(Is));
+}
+
+template <typename T, std::size_t... Is> std::vector<std::size_t> leaf_bit_widths(index_sequence<Is...> _)
+{
+  return std::vector<std::size_t>{LeafBitsOf<T, Is>::width...};
+}
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Number of bits used by each packed record of \c T
+ *
+ * Each leaf member (see <code>leaf_types_t</code>) uses:
+ * - 1 bit, if \c bool
+ * - the fewest bits which hold every value in its range, if an integer declared with <code>ABOUT_FIELD_RANGE</code>,
+ *   or an enum (between its smallest and largest enumerator)
+ * - its full width, otherwise
+ *
+ * @tparam T  reflected class type
+ */
+template <typename T> constexpr std::size_t bit_width = detail::total_bits<T>(make_index_sequence<leaf_count<T>>{});
+
+/**
+ * @brief Number of 64-bit words used by each packed record of \c T
+ */
+template <typename T> constexpr std::size_t word_count = (bit_width<T> + 63) / 64;
+
+/**
+ * @brief Packed record of \c T
+ */
+template <typename T> using packed_t = std::array<std::uint64_t, word_count<T>>;
+
+/**
+ * @brief Returns number of bits used by each leaf member of \c T, in the order of <code>leaf_names<T>()</code>
+ */
+template <typename T> std::vector<std::size_t> leaf_bit_widths()
+{
+  return detail::leaf_bit_widths<T>(make_index_sequence<leaf_count<T>>{});
+}
+
+/**
+ * @brief Packs the leaf members of \c value into 64-bit words, each with its minimum bit width (see
+ *        <code>bit_width</code>)
+ *
+ * @code{.cpp}
+ * const about::bitpack::packed_t<Fill> packed = about::bitpack::encode(fill);
+ * const Fill unpacked = about::bitpack::decode<Fill>(packed);
+ * @endcode
+ *
+ * @throws std::out_of_range  if a member is outside of its declared range
+ */
+template <typename T, typename = std::enable_if_t<is_reflected_class<T>>> packed_t<T> encode(const T& value)
+{
+  packed_t<T> words{};
+  detail::write_leaves(value, words.data(), make_index_sequence<leaf_count<T>>{});
+  return words;
+}
+
+/**
+ * @brief Packs each record of \c values
+ *
+ * @throws std::out_of_range  if a member is outside of its declared range
+ */
+template <typename T, typename AllocatorT> std::vector<packed_t<T>> encode(const std::vector<T, AllocatorT>& values)
+{
+  std::vector<packed_t<T>> packed;
+  packed.reserve(values.size());
+  for (const auto& value : values)
+  {
+    packed.push_back(encode(value));
+  }
+  return packed;
+}
+
+/**
+ * @brief Unpacks leaf members of \c value from \c words
+ */
+template <typename T> void decode(const packed_t<T>& words, T& value)
+{
+  static_assert(is_reflected_class<T>, "bitpack requires a reflected class type");
+  detail::read_leaves(words.data(), value, make_index_sequence<leaf_count<T>>{});
+}
+
+/**
+ * @brief Returns record unpacked from \c words
+ */
+template <typename T> T decode(const packed_t<T>& words)
+{
+  T value{};
+  decode(words, value);
+  return value;
+}
+
+/**
+ * @brief Returns records unpacked from each of \c packed
+ */
+template <typename T> std::vector<T> decode(const std::vector<packed_t<T>>& packed)
+{
+  std::vector<T> values(packed.size());
+  for (std::size_t i = 0; i < packed.size(); ++i)
+  {
+    decode(packed[i], values[i]);
+  }
+  return values;
+}
+
+}  // namespace bitpack
+}  // namespace about
+
+#endif  // ABOUT_BITPACK_HPP
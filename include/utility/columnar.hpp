@@ -0,0 +1,586 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_COLUMNAR_HPP
+#define ABOUT_COLUMNAR_HPP
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// About
+#include <about/about.hpp>
+#include <about/flatten.hpp>
+#include <about/for_each.hpp>
+
+namespace about
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/// Leading and trailing file magic
+static constexpr char kColumnarMagic[8] = {'A', 'B', 'T', 'C', 'O', 'L', '0', '1'};
+
+/// Alignment of each column buffer, relative to start of file
+static constexpr std::uint64_t kColumnarAlignment = 64;
+
+/// Size of the slot used to store per-chunk min/max statistics
+static constexpr std::size_t kColumnarStatSize = 8;
+
+/**
+ * @brief Value kind stored in a column, used to check reads against the written type
+ */
+enum class ColumnKind : std::uint8_t
+{
+  Unsigned = 0,
+  Signed = 1,
+  Floating = 2,
+};
+
+template <typename T, typename Enable = void> struct ColumnOrderedType
+{
+  using type = T;
+};
+
+template <typename T> struct ColumnOrderedType<T, std::enable_if_t<std::is_enum<T>::value>>
+{
+  using type = std::underlying_type_t<T>;
+};
+
+/// Enums are stored, compared and type-checked as their underlying integer type
+template <typename T> using column_ordered_t = typename ColumnOrderedType<T>::type;
+
+template <typename T> constexpr std::uint8_t column_type_code()
+{
+  using U = column_ordered_t<T>;
+  static_assert(std::is_arithmetic<U>::value, "column values must be arithmetic or enum types");
+  static_assert(sizeof(U) <= kColumnarStatSize, "column values must be at most 8 bytes wide");
+  constexpr auto kind = std::is_floating_point<U>::value ? ColumnKind::Floating
+    : std::is_signed<U>::value                           ? ColumnKind::Signed
+                                                         : ColumnKind::Unsigned;
+  return static_cast<std::uint8_t>((static_cast<std::uint8_t>(kind) << 4) | sizeof(U));
+}
+
+/**
+ * @brief Location and statistics of one column within one chunk
+ */
+struct ColumnChunkInfo
+{
+  std::uint64_t offset;
+  char min[kColumnarStatSize];
+  char max[kColumnarStatSize];
+};
+
+/**
+ * @brief Location and statistics of all columns within one chunk
+ */
+struct ChunkInfo
+{
+  std::uint64_t rows;
+  std::vector<ColumnChunkInfo> columns;
+};
+
+template <typename T> inline void write_pod(std::ostream& os, const T& value)
+{
+  os.write(reinterpret_cast<const char*>(std::addressof(value)), sizeof(T));
+}
+
+template <typename T> inline T read_pod(const char*& cursor)
+{
+  T value;
+  std::memcpy(std::addressof(value), cursor, sizeof(T));
+  cursor += sizeof(T);
+  return value;
+}
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Streams chunks of reflected records to a column-oriented file
+ *
+ * Every leaf member of \c T (see <code>leaf_names</code>) is stored as one contiguous buffer per appended chunk,
+ * along with the min/max value of that buffer. Metadata is written as a footer by <code>close</code>, so chunks can be
+ * appended without holding previously written records in memory.
+ *
+ * @code{.cpp}
+ * column_writer<my_ns::MyClass> writer{"records.col"};
+ * writer.append(first_batch);
+ * writer.append(second_batch);
+ * writer.close();
+ * @endcode
+ *
+ * @tparam T  reflected record type; all leaf members must be arithmetic or enum types
+ */
+template <typename T> class column_writer
+{
+  static_assert(is_reflected_class<T>, "column_writer requires a reflected class type");
+
+public:
+  /**
+   * @brief Opens \c path for writing, truncating any existing file
+   *
+   * @throws std::runtime_error  if file could not be opened
+   */
+  explicit column_writer(const std::string& path) : os_{path, std::ios::binary | std::ios::trunc}, offset_{0}
+  {
+    if (!os_)
+    {
+      throw std::runtime_error{"column_writer: failed to open " + path};
+    }
+    os_.write(detail::kColumnarMagic, sizeof(detail::kColumnarMagic));
+    offset_ += sizeof(detail::kColumnarMagic);
+  }
+
+  column_writer(const column_writer&) = delete;
+  column_writer& operator=(const column_writer&) = delete;
+
+  /**
+   * @brief Writes footer, if <code>close</code> was not called explicitly
+   */
+  ~column_writer()
+  {
+    if (os_.is_open())
+    {
+      try
+      {
+        close();
+      }
+      catch (...)
+      {}
+    }
+  }
+
+  /**
+   * @brief Transposes \c records into one buffer per column and writes them as a single chunk
+   *
+   * @throws std::runtime_error  on write failure
+   */
+  void append(const std::vector<T>& records)
+  {
+    if (records.empty())
+    {
+      return;
+    }
+
+    buffers_type buffers;
+    ::about::for_each([n = records.size()](auto& column) { column.reserve(n); }, buffers);
+    for (const auto& record : records)
+    {
+      ::about::detail::for_each_leaf_unrecorded(
+        [&buffers](auto index, const auto& leaf) { std::get<decltype(index)::value>(buffers).push_back(leaf); },
+        record);
+    }
+
+    detail::ChunkInfo chunk{records.size(), std::vector<detail::ColumnChunkInfo>(leaf_count<T>)};
+    std::size_t c = 0;
+    ::about::for_each(
+      [this, &chunk, &c](const auto& column) {
+        using ValueT = typename std::remove_reference_t<decltype(column)>::value_type;
+        using OrderedT = detail::column_ordered_t<ValueT>;
+
+        pad_to_alignment();
+        auto& info = chunk.columns[c++];
+        info.offset = offset_;
+
+        const auto minmax = std::minmax_element(column.begin(), column.end(), [](const ValueT& lhs, const ValueT& rhs) {
+          return static_cast<OrderedT>(lhs) < static_cast<OrderedT>(rhs);
+        });
+        std::memset(info.min, 0, sizeof(info.min));
+        std::memset(info.max, 0, sizeof(info.max));
+        std::memcpy(info.min, std::addressof(*minmax.first), sizeof(ValueT));
+        std::memcpy(info.max, std::addressof(*minmax.second), sizeof(ValueT));
+
+        const std::size_t bytes = column.size() * sizeof(ValueT);
+        os_.write(reinterpret_cast<const char*>(column.data()), bytes);
+        offset_ += bytes;
+      },
+      buffers);
+
+    if (!os_)
+    {
+      throw std::runtime_error{"column_writer: write failed"};
+    }
+    rows_ += records.size();
+    chunks_.emplace_back(std::move(chunk));
+  }
+
+  /**
+   * @brief Writes column descriptions, chunk index and statistics, then closes the file
+   *
+   * @throws std::runtime_error  on write failure
+   */
+  void close()
+  {
+    const std::uint64_t footer_offset = offset_;
+
+    const auto names = leaf_names<T>();
+    const auto codes = type_codes(make_index_sequence<leaf_count<T>>{});
+    detail::write_pod(os_, static_cast<std::uint64_t>(names.size()));
+    for (std::size_t c = 0; c < names.size(); ++c)
+    {
+      detail::write_pod(os_, static_cast<std::uint64_t>(names[c].size()));
+      os_.write(names[c].data(), names[c].size());
+      detail::write_pod(os_, codes[c]);
+    }
+
+    detail::write_pod(os_, static_cast<std::uint64_t>(chunks_.size()));
+    for (const auto& chunk : chunks_)
+    {
+      detail::write_pod(os_, chunk.rows);
+      for (const auto& column : chunk.columns)
+      {
+        detail::write_pod(os_, column.offset);
+        os_.write(column.min, sizeof(column.min));
+        os_.write(column.max, sizeof(column.max));
+      }
+    }
+
+    detail::write_pod(os_, footer_offset);
+    os_.write(detail::kColumnarMagic, sizeof(detail::kColumnarMagic));
+    os_.close();
+    if (!os_)
+    {
+      throw std::runtime_error{"column_writer: failed to write footer"};
+    }
+  }
+
+  /**
+   * @brief Returns number of records appended so far
+   */
+  std::size_t size() const { return rows_; }
+
+private:
+  using buffers_type = leaf_vectors_t<T>;
+
+  template <std::size_t... Indices> static std::vector<std::uint8_t> type_codes(index_sequence<Indices...> _)
+  {
+    return {detail::column_type_code<std::tuple_element_t<Indices, leaf_types_t<T>>>()...};
+  }
+
+  void pad_to_alignment()
+  {
+    static constexpr char kZeros[detail::kColumnarAlignment] = {};
+    const std::uint64_t padding = (detail::kColumnarAlignment - offset_ % detail::kColumnarAlignment) %
+      detail::kColumnarAlignment;
+    os_.write(kZeros, padding);
+    offset_ += padding;
+  }
+
+  std::ofstream os_;
+  std::uint64_t offset_;
+  std::size_t rows_ = 0;
+  std::vector<detail::ChunkInfo> chunks_;
+};
+
+/**
+ * @brief Read-only view of a single column across all chunks of a mapped column file
+ *
+ * @tparam ValueT  column value type
+ */
+template <typename ValueT> class column_view
+{
+public:
+  /**
+   * @brief Returns number of chunks in the column
+   */
+  std::size_t chunk_count() const { return chunks_.size(); }
+
+  /**
+   * @brief Returns number of values in chunk \c chunk
+   */
+  std::size_t size(const std::size_t chunk) const { return chunks_[chunk].rows; }
+
+  /**
+   * @brief Returns pointer to the contiguous values of chunk \c chunk
+   */
+  const ValueT* data(const std::size_t chunk) const
+  {
+    return reinterpret_cast<const ValueT*>(base_ + chunks_[chunk].offset);
+  }
+
+  /**
+   * @brief Returns smallest value in chunk \c chunk
+   */
+  ValueT min(const std::size_t chunk) const { return stat(chunks_[chunk].min); }
+
+  /**
+   * @brief Returns largest value in chunk \c chunk
+   */
+  ValueT max(const std::size_t chunk) const { return stat(chunks_[chunk].max); }
+
+private:
+  friend class column_reader;
+
+  struct Chunk
+  {
+    std::uint64_t rows;
+    std::uint64_t offset;
+    const char* min;
+    const char* max;
+  };
+
+  static ValueT stat(const char* slot)
+  {
+    ValueT value;
+    std::memcpy(std::addressof(value), slot, sizeof(ValueT));
+    return value;
+  }
+
+  const char* base_ = nullptr;
+  std::vector<Chunk> chunks_;
+};
+
+/**
+ * @brief Memory-maps a file produced by <code>column_writer</code> and projects individual columns out of it
+ *
+ * Only pages belonging to columns which are actually scanned are faulted in.
+ *
+ * @code{.cpp}
+ * column_reader reader{"records.col"};
+ * const auto c = reader.column<double>("c");
+ * for (std::size_t chunk = 0; chunk < c.chunk_count(); ++chunk)
+ * {
+ *   if (c.max(chunk) < threshold) { continue; }
+ *   std::accumulate(c.data(chunk), c.data(chunk) + c.size(chunk), 0.0);
+ * }
+ * @endcode
+ */
+class column_reader
+{
+public:
+  /**
+   * @brief Maps \c path and parses its column index
+   *
+   * @throws std::runtime_error  if file could not be mapped or is not a column file
+   */
+  explicit column_reader(const std::string& path)
+  {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      throw std::runtime_error{"column_reader: failed to open " + path};
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(2 * sizeof(detail::kColumnarMagic) + 8))
+    {
+      ::close(fd);
+      throw std::runtime_error{"column_reader: invalid column file " + path};
+    }
+    size_ = static_cast<std::size_t>(st.st_size);
+
+    void* const mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED)
+    {
+      throw std::runtime_error{"column_reader: failed to map " + path};
+    }
+    base_ = static_cast<const char*>(mapped);
+
+    try
+    {
+      parse_footer();
+    }
+    catch (...)
+    {
+      ::munmap(const_cast<char*>(base_), size_);
+      throw;
+    }
+  }
+
+  column_reader(column_reader&& other) noexcept :
+      base_{other.base_},
+      size_{other.size_},
+      rows_{other.rows_},
+      names_{std::move(other.names_)},
+      codes_{std::move(other.codes_)},
+      chunks_{std::move(other.chunks_)}
+  {
+    other.base_ = nullptr;
+  }
+
+  column_reader(const column_reader&) = delete;
+  column_reader& operator=(const column_reader&) = delete;
+  column_reader& operator=(column_reader&&) = delete;
+
+  ~column_reader()
+  {
+    if (base_ != nullptr)
+    {
+      ::munmap(const_cast<char*>(base_), size_);
+    }
+  }
+
+  /**
+   * @brief Returns total number of records in the file
+   */
+  std::size_t size() const { return rows_; }
+
+  /**
+   * @brief Returns number of chunks in the file
+   */
+  std::size_t chunk_count() const { return chunks_.size(); }
+
+  /**
+   * @brief Returns flattened names of all stored columns
+   */
+  const std::vector<std::string>& column_names() const { return names_; }
+
+  /**
+   * @brief Returns a view of column \c name
+   *
+   * Views reference mapped memory, and must not outlive this reader.
+   *
+   * @tparam ValueT  type the column was written as (or an enum with that underlying type)
+   *
+   * @throws std::out_of_range  if no such column exists
+   * @throws std::invalid_argument  if \c ValueT does not match the stored column type
+   */
+  template <typename ValueT> column_view<ValueT> column(const std::string& name) const
+  {
+    const auto itr = std::find(names_.begin(), names_.end(), name);
+    if (itr == names_.end())
+    {
+      throw std::out_of_range{"column_reader: no column named " + name};
+    }
+
+    const std::size_t c = static_cast<std::size_t>(std::distance(names_.begin(), itr));
+    if (codes_[c] != detail::column_type_code<ValueT>())
+    {
+      throw std::invalid_argument{"column_reader: type mismatch for column " + name};
+    }
+
+    column_view<ValueT> view;
+    view.base_ = base_;
+    view.chunks_.reserve(chunks_.size());
+    for (const auto& chunk : chunks_)
+    {
+      const auto& column = chunk.columns[c];
+      view.chunks_.push_back({chunk.rows, column.offset, column.min, column.max});
+    }
+    return view;
+  }
+
+private:
+  struct ColumnChunk
+  {
+    std::uint64_t offset;
+    const char* min;
+    const char* max;
+  };
+
+  struct Chunk
+  {
+    std::uint64_t rows;
+    std::vector<ColumnChunk> columns;
+  };
+
+  void parse_footer()
+  {
+    const char* const trailer = base_ + size_ - sizeof(detail::kColumnarMagic) - sizeof(std::uint64_t);
+    if (std::memcmp(base_, detail::kColumnarMagic, sizeof(detail::kColumnarMagic)) != 0 ||
+        std::memcmp(trailer + sizeof(std::uint64_t), detail::kColumnarMagic, sizeof(detail::kColumnarMagic)) != 0)
+    {
+      throw std::runtime_error{"column_reader: bad magic"};
+    }
+
+    const char* cursor = trailer;
+    const auto footer_offset = detail::read_pod<std::uint64_t>(cursor);
+    if (footer_offset > static_cast<std::uint64_t>(trailer - base_))
+    {
+      throw std::runtime_error{"column_reader: bad footer offset"};
+    }
+    cursor = base_ + footer_offset;
+
+    // Bytes left in the footer; sizes read from the file are checked against this before use
+    const auto remaining = [&cursor, trailer]() { return static_cast<std::uint64_t>(trailer - cursor); };
+
+    if (remaining() < sizeof(std::uint64_t))
+    {
+      throw std::runtime_error{"column_reader: truncated footer"};
+    }
+    const auto column_count = detail::read_pod<std::uint64_t>(cursor);
+    if (column_count > remaining() / (sizeof(std::uint64_t) + sizeof(std::uint8_t)))
+    {
+      throw std::runtime_error{"column_reader: bad column count"};
+    }
+    names_.reserve(column_count);
+    codes_.reserve(column_count);
+    for (std::uint64_t c = 0; c < column_count; ++c)
+    {
+      if (remaining() < sizeof(std::uint64_t))
+      {
+        throw std::runtime_error{"column_reader: truncated column names"};
+      }
+      const auto length = detail::read_pod<std::uint64_t>(cursor);
+      if (remaining() < sizeof(std::uint8_t) || length > remaining() - sizeof(std::uint8_t))
+      {
+        throw std::runtime_error{"column_reader: bad column name length"};
+      }
+      names_.emplace_back(cursor, length);
+      cursor += length;
+      codes_.push_back(detail::read_pod<std::uint8_t>(cursor));
+    }
+
+    if (remaining() < sizeof(std::uint64_t))
+    {
+      throw std::runtime_error{"column_reader: truncated chunk index"};
+    }
+    const auto chunk_count = detail::read_pod<std::uint64_t>(cursor);
+    if (chunk_count > remaining() / (sizeof(std::uint64_t) + column_count * sizeof(detail::ColumnChunkInfo)))
+    {
+      throw std::runtime_error{"column_reader: truncated chunk index"};
+    }
+    chunks_.reserve(chunk_count);
+    for (std::uint64_t i = 0; i < chunk_count; ++i)
+    {
+      Chunk chunk;
+      chunk.rows = detail::read_pod<std::uint64_t>(cursor);
+      rows_ += chunk.rows;
+      chunk.columns.reserve(column_count);
+      for (std::uint64_t c = 0; c < column_count; ++c)
+      {
+        ColumnChunk column;
+        column.offset = detail::read_pod<std::uint64_t>(cursor);
+        const std::uint64_t width = codes_[c] & 0xF;
+        if (column.offset > footer_offset || (width != 0 && chunk.rows > (footer_offset - column.offset) / width))
+        {
+          throw std::runtime_error{"column_reader: column buffer out of bounds"};
+        }
+        column.min = cursor;
+        column.max = cursor + detail::kColumnarStatSize;
+        cursor += 2 * detail::kColumnarStatSize;
+        chunk.columns.push_back(column);
+      }
+      chunks_.emplace_back(std::move(chunk));
+    }
+  }
+
+  const char* base_ = nullptr;
+  std::size_t size_ = 0;
+  std::size_t rows_ = 0;
+  std::vector<std::string> names_;
+  std::vector<std::uint8_t> codes_;
+  std::vector<Chunk> chunks_;
+};
+
+}  // namespace about
+
+#endif  // ABOUT_COLUMNAR_HPP
@@ -0,0 +1,276 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_CONVERT_HPP
+#define ABOUT_CONVERT_HPP
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// About
+#include <about/about.hpp>
+#include <about/flatten.hpp>
+#include <about/integer_sequence.hpp>
+#include <about/var.hpp>
+
+namespace about
+{
+
+/**
+ * @brief Controls which unmatched members are rejected (via <code>static_assert</code>) by <code>convert</code>
+ */
+enum class convert_policy
+{
+  /// Every member of the source and destination must have a counterpart
+  exact,
+  /// Every member of the destination must have a source; extra source members are ignored
+  complete,
+  /// Unmatched destination members are left unmodified; extra source members are ignored
+  partial
+};
+
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/// Index of the source member with the same name as \c ToInfoT, or the number of source members
+template <typename ToInfoT, typename FromInfoTupleT> struct SourceIndex;
+
+template <typename ToInfoT, typename... FromInfoTs> struct SourceIndex<ToInfoT, std::tuple<FromInfoTs...>>
+{
+  static constexpr std::size_t value = find_name(ToInfoT::name, {FromInfoTs::name...});
+  static constexpr bool found = value < sizeof...(FromInfoTs);
+};
+
+/**
+ * @brief Compile-time pairing of destination members of \c To with source members of \c From
+ */
+template <typename To, typename From, typename ToInfoTupleT = public_var_info_t<To>> struct MemberMatching;
+
+template <typename To, typename From, typename... ToInfoTs> struct MemberMatching<To, From, std::tuple<ToInfoTs...>>
+{
+  using from_info = public_var_info_t<From>;
+
+  static constexpr std::size_t kFromCount = std::tuple_size<from_info>::value;
+
+  /// Number of destination members with a source
+  static constexpr std::size_t matched =
+    partial_sum({static_cast<std::size_t>(SourceIndex<ToInfoTs, from_info>::found)...}, sizeof...(ToInfoTs));
+
+  /// Destination index -> source index (or kFromCount)
+  static constexpr std::size_t source(const std::size_t i)
+  {
+    return std::initializer_list<std::size_t>{SourceIndex<ToInfoTs, from_info>::value...}.begin()[i];
+  }
+
+  /// Destination member \c i has a source of identical, trivially-copyable type, so it may be copied as raw bytes
+  static constexpr bool raw(const std::size_t i)
+  {
+    return std::initializer_list<bool>{RawCopyable<ToInfoTs>::value...}.begin()[i];
+  }
+
+  /// Destination member \c i is copied by the run which starts before it
+  static constexpr bool continues_run(const std::size_t i)
+  {
+    return i > 0 && raw(i) && raw(i - 1) && source(i) == source(i - 1) + 1;
+  }
+
+  /// Number of destination members, starting at \c i, which are candidates for a single <code>memcpy</code>
+  static constexpr std::size_t run_length(const std::size_t i)
+  {
+    std::size_t n = 1;
+    while (i + n < sizeof...(ToInfoTs) && continues_run(i + n))
+    {
+      ++n;
+    }
+    return n;
+  }
+
+private:
+  template <typename ToInfoT, typename Enable = void> struct RawCopyable : std::false_type
+  {};
+
+  template <typename ToInfoT>
+  struct RawCopyable<ToInfoT, std::enable_if_t<SourceIndex<ToInfoT, from_info>::found>>
+      : std::integral_constant<
+          bool,
+          std::is_same<
+            typename ToInfoT::type,
+            typename std::tuple_element_t<SourceIndex<ToInfoT, from_info>::value, from_info>::type>::value &&
+            std::is_trivially_copyable<typename ToInfoT::type>::value>
+  {};
+};
+
+template <typename T> inline const char* address_of(const T& value)
+{
+  return reinterpret_cast<const char*>(std::addressof(value));
+}
+
+template <typename T> inline char* address_of(T& value) { return reinterpret_cast<char*>(std::addressof(value)); }
+
+template <convert_policy Policy, typename To, typename From> void convert_into(const From& from, To& to);
+
+template <convert_policy Policy, typename ToMemberT, typename FromMemberT>
+inline std::enable_if_t<is_reflected_class<ToMemberT> && is_reflected_class<FromMemberT>>
+convert_member(const FromMemberT& from, ToMemberT& to)
+{
+  convert_into<Policy>(from, to);
+}
+
+template <convert_policy Policy, typename ToMemberT, typename FromMemberT>
+inline std::enable_if_t<!(is_reflected_class<ToMemberT> && is_reflected_class<FromMemberT>)>
+convert_member(const FromMemberT& from, ToMemberT& to)
+{
+  static_assert(
+    std::is_convertible<const FromMemberT&, ToMemberT>::value,
+    "convert: members with the same name have incompatible types");
+  to = static_cast<ToMemberT>(from);
+}
+
+/**
+ * @brief Copies destination members <code>[Start, Start + Length)</code> from their sources
+ *
+ * Uses one <code>memcpy</code> when the members are packed back-to-back, at the same relative offsets, in both
+ * objects. Packing is checked on addresses of the actual members, which the compiler folds to constants.
+ */
+template <typename Matching, std::size_t Start, std::size_t Length> struct RunCopier
+{
+  template <typename ToVarsT, typename FromVarsT, std::size_t... Ks>
+  static bool packed(ToVarsT& to, const FromVarsT& from, index_sequence<Ks...> _)
+  {
+    bool result = true;
+    [[maybe_unused]] const auto __list = std::initializer_list<int>{
+      0,
+      (result = result &&
+         (address_of(std::get<Start + Ks + 1>(to)) ==
+          address_of(std::get<Start + Ks>(to)) + sizeof(std::get<Start + Ks>(to))) &&
+         (address_of(std::get<Matching::source(Start + Ks + 1)>(from)) ==
+          address_of(std::get<Matching::source(Start + Ks)>(from)) + sizeof(std::get<Matching::source(Start + Ks)>(from))),
+       0)...};
+    return result;
+  }
+
+  template <convert_policy Policy, typename ToVarsT, typename FromVarsT, std::size_t... Ks>
+  static void each(ToVarsT& to, const FromVarsT& from, index_sequence<Ks...> _)
+  {
+    [[maybe_unused]] const auto __list = std::initializer_list<int>{
+      0, (convert_member<Policy>(std::get<Matching::source(Start + Ks)>(from), std::get<Start + Ks>(to)), 0)...};
+  }
+
+  template <convert_policy Policy, typename ToVarsT, typename FromVarsT>
+  static void copy(ToVarsT& to, const FromVarsT& from, std::true_type _)
+  {
+    if (packed(to, from, make_index_sequence<Length - 1>{}))
+    {
+      char* const first = address_of(std::get<Start>(to));
+      char* const last = address_of(std::get<Start + Length - 1>(to)) + sizeof(std::get<Start + Length - 1>(to));
+      std::memcpy(first, address_of(std::get<Matching::source(Start)>(from)), static_cast<std::size_t>(last - first));
+    }
+    else
+    {
+      each<Policy>(to, from, make_index_sequence<Length>{});
+    }
+  }
+
+  template <convert_policy Policy, typename ToVarsT, typename FromVarsT>
+  static void copy(ToVarsT& to, const FromVarsT& from, std::false_type _)
+  {
+    each<Policy>(to, from, make_index_sequence<Length>{});
+  }
+};
+
+template <typename Matching, std::size_t I, typename Enable = void> struct MemberCopier
+{
+  /// Unmatched destination member, or member copied as part of an earlier run
+  template <convert_policy Policy, typename ToVarsT, typename FromVarsT>
+  static void copy(ToVarsT& to, const FromVarsT& from)
+  {}
+};
+
+template <typename Matching, std::size_t I>
+struct MemberCopier<
+  Matching,
+  I,
+  std::enable_if_t<(Matching::source(I) < Matching::kFromCount) && !Matching::continues_run(I)>>
+{
+  template <convert_policy Policy, typename ToVarsT, typename FromVarsT>
+  static void copy(ToVarsT& to, const FromVarsT& from)
+  {
+    static constexpr std::size_t Length = Matching::run_length(I);
+    RunCopier<Matching, I, Length>::template copy<Policy>(
+      to, from, std::integral_constant<bool, (Length > 1)>{});
+  }
+};
+
+template <convert_policy Policy, typename Matching, typename ToVarsT, typename FromVarsT, std::size_t... Is>
+inline void convert_members(ToVarsT&& to, const FromVarsT& from, index_sequence<Is...> _)
+{
+  [[maybe_unused]] const auto __list =
+    std::initializer_list<int>{0, (MemberCopier<Matching, Is>::template copy<Policy>(to, from), 0)...};
+}
+
+template <convert_policy Policy, typename To, typename From> void convert_into(const From& from, To& to)
+{
+  static_assert(is_reflected_class<To> && is_reflected_class<From>, "convert requires reflected class types");
+
+  using Matching = MemberMatching<To, From>;
+  static constexpr std::size_t kToCount = std::tuple_size<public_var_info_t<To>>::value;
+  static_assert(
+    Policy == convert_policy::partial || Matching::matched == kToCount,
+    "convert: destination has members with no source member of the same name");
+  static_assert(
+    Policy != convert_policy::exact || Matching::matched == Matching::kFromCount,
+    "convert: source has members with no destination member of the same name");
+
+  convert_members<Policy, Matching>(
+    ::about::detail::get_public_vars_unrecorded(to),
+    ::about::detail::get_public_vars_unrecorded(from),
+    make_index_sequence<kToCount>{});
+}
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Copies public members of \c from into public members of \c to with the same name
+ *
+ * Members are paired at compile time. Pairs of nested reflected classes are converted recursively (with the same
+ * \c Policy); other pairs are assigned, with conversion if their types differ. Consecutive members with identical
+ * trivially-copyable types, laid out identically in both classes, are copied with a single <code>memcpy</code>.
+ *
+ * @tparam Policy  which unmatched members are compile-time errors
+ */
+template <convert_policy Policy = convert_policy::complete, typename To, typename From>
+inline void convert_into(const From& from, To& to)
+{
+  detail::convert_into<Policy>(from, to);
+}
+
+/**
+ * @brief Returns a value-initialized \c To with members copied from same-named members of \c from
+ *
+ * @code{.cpp}
+ * const auto internal = about::convert<Pose>(wire_pose);
+ * const auto labeled = about::convert<LabeledPose, about::convert_policy::partial>(wire_pose);
+ * @endcode
+ *
+ * @copydetails convert_into
+ */
+template <typename To, convert_policy Policy = convert_policy::complete, typename From>
+inline To convert(const From& from)
+{
+  To to{};
+  detail::convert_into<Policy>(from, to);
+  return to;
+}
+
+}  // namespace about
+
+#endif  // ABOUT_CONVERT_HPP
@@ -0,0 +1,672 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_CSV_HPP
+#define ABOUT_CSV_HPP
+
+// C++ Standard Library
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// POSIX
+#include <locale.h>
+#include <stdlib.h>
+
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// About
+#include <about/about.hpp>
+#include <about/flatten.hpp>
+#include <about/integer_sequence.hpp>
+
+namespace about
+{
+namespace csv
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/**
+ * @brief Returns pointer to the first \c delimiter or newline in <code>[first, last)</code>, or \c last
+ *
+ * Scans 32 (AVX2) or 16 (SSE2) bytes per step where available, with a scalar tail
+ */
+inline const char* find_structural(const char* first, const char* const last, const char delimiter)
+{
+#if defined(__AVX2__)
+  {
+    const __m256i d = _mm256_set1_epi8(delimiter);
+    const __m256i nl = _mm256_set1_epi8('\n');
+    for (; last - first >= 32; first += 32)
+    {
+      const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+      const unsigned mask = static_cast<unsigned>(
+        _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(block, d), _mm256_cmpeq_epi8(block, nl))));
+      if (mask != 0)
+      {
+        return first + __builtin_ctz(mask);
+      }
+    }
+  }
+#endif  // __AVX2__
+#if defined(__SSE2__)
+  {
+    const __m128i d = _mm_set1_epi8(delimiter);
+    const __m128i nl = _mm_set1_epi8('\n');
+    for (; last - first >= 16; first += 16)
+    {
+      const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+      const unsigned mask =
+        static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, d), _mm_cmpeq_epi8(block, nl))));
+      if (mask != 0)
+      {
+        return first + __builtin_ctz(mask);
+      }
+    }
+  }
+#endif  // __SSE2__
+  for (; first != last; ++first)
+  {
+    if (*first == delimiter || *first == '\n')
+    {
+      return first;
+    }
+  }
+  return last;
+}
+
+template <typename IntT> inline bool parse_integer(const char* first, const char* const last, IntT& value)
+{
+  using UIntT = std::make_unsigned_t<IntT>;
+
+  bool negative = false;
+  if (first != last && (*first == '-' || *first == '+'))
+  {
+    negative = (*first == '-');
+    if (negative && !std::is_signed<IntT>::value)
+    {
+      return false;
+    }
+    ++first;
+  }
+  if (first == last)
+  {
+    return false;
+  }
+
+  const UIntT limit = negative ? static_cast<UIntT>(static_cast<UIntT>(std::numeric_limits<IntT>::max()) + 1U)
+                               : static_cast<UIntT>(std::numeric_limits<IntT>::max());
+  UIntT accumulated = 0;
+  for (; first != last; ++first)
+  {
+    const unsigned digit = static_cast<unsigned>(*first) - static_cast<unsigned>('0');
+    if (digit > 9U || accumulated > (limit - digit) / 10U)
+    {
+      return false;
+    }
+    accumulated = static_cast<UIntT>(accumulated * 10U + digit);
+  }
+  value = negative ? static_cast<IntT>(UIntT{0} - accumulated) : static_cast<IntT>(accumulated);
+  return true;
+}
+
+/**
+ * @brief Returns handle to the "C" locale, so that parsing does not depend on the global <code>LC_NUMERIC</code>
+ */
+inline locale_t c_locale()
+{
+  static const locale_t locale = ::newlocale(LC_ALL_MASK, "C", static_cast<locale_t>(0));
+  if (locale == static_cast<locale_t>(0))
+  {
+    throw std::runtime_error{"csv: failed to create C locale"};
+  }
+  return locale;
+}
+
+inline float strto(const char* str, char** end, float _) { return ::strtof_l(str, end, c_locale()); }
+
+inline double strto(const char* str, char** end, double _) { return ::strtod_l(str, end, c_locale()); }
+
+inline long double strto(const char* str, char** end, long double _) { return ::strtold_l(str, end, c_locale()); }
+
+/**
+ * @brief Checks that <code>[first, last)</code> is a decimal number, <code>[+-]digits[.digits][(e|E)[+-]digits]</code>
+ *
+ * Rejects forms otherwise accepted by \c strtod, i.e. leading whitespace, \c inf, \c nan and hexadecimal
+ */
+inline bool is_decimal(const char* first, const char* const last)
+{
+  const auto skip_sign = [&first, last] {
+    if (first != last && (*first == '-' || *first == '+'))
+    {
+      ++first;
+    }
+  };
+  const auto skip_digits = [&first, last] {
+    const char* const start = first;
+    while (first != last && static_cast<unsigned>(*first) - static_cast<unsigned>('0') <= 9U)
+    {
+      ++first;
+    }
+    return first != start;
+  };
+
+  skip_sign();
+  bool mantissa = skip_digits();
+  if (first != last && *first == '.')
+  {
+    ++first;
+    mantissa = skip_digits() || mantissa;
+  }
+  if (!mantissa)
+  {
+    return false;
+  }
+  if (first != last && (*first == 'e' || *first == 'E'))
+  {
+    ++first;
+    skip_sign();
+    if (!skip_digits())
+    {
+      return false;
+    }
+  }
+  return first == last;
+}
+
+template <typename FloatT> inline bool parse_floating(const char* first, const char* const last, FloatT& value)
+{
+  // Local, null-terminated copy; numeric fields longer than this are not meaningful
+  char buffer[64];
+  const std::size_t length = static_cast<std::size_t>(last - first);
+  if (length == 0 || length >= sizeof(buffer) || !is_decimal(first, last))
+  {
+    return false;
+  }
+  std::memcpy(buffer, first, length);
+  buffer[length] = '\0';
+
+  char* end = nullptr;
+  errno = 0;
+  const FloatT parsed = strto(buffer, &end, FloatT{});
+  if (end != buffer + length || errno == ERANGE)
+  {
+    return false;
+  }
+  value = parsed;
+  return true;
+}
+
+inline bool parse_field(const char* first, const char* last, bool& value)
+{
+  const std::size_t length = static_cast<std::size_t>(last - first);
+  if ((length == 1 && *first == '1') || (length == 4 && std::memcmp(first, "true", 4) == 0))
+  {
+    value = true;
+    return true;
+  }
+  if ((length == 1 && *first == '0') || (length == 5 && std::memcmp(first, "false", 5) == 0))
+  {
+    value = false;
+    return true;
+  }
+  return false;
+}
+
+inline bool parse_field(const char* first, const char* last, std::string& value)
+{
+  value.assign(first, last);
+  return true;
+}
+
+template <typename T>
+inline std::enable_if_t<std::is_integral<T>::value, bool> parse_field(const char* first, const char* last, T& value)
+{
+  return parse_integer(first, last, value);
+}
+
+template <typename T>
+inline std::enable_if_t<std::is_floating_point<T>::value, bool>
+parse_field(const char* first, const char* last, T& value)
+{
+  return parse_floating(first, last, value);
+}
+
+template <typename T>
+inline std::enable_if_t<std::is_enum<T>::value, bool> parse_field(const char* first, const char* last, T& value)
+{
+  std::underlying_type_t<T> underlying;
+  if (!parse_integer(first, last, underlying))
+  {
+    return false;
+  }
+  value = static_cast<T>(underlying);
+  return true;
+}
+
+/**
+ * @brief Parses a field into leaf \c I of \c record; empty fields leave the leaf unmodified
+ */
+template <typename T, std::size_t I> bool parse_leaf(T& record, const char* first, const char* last)
+{
+  return (first == last) || parse_field(first, last, ::about::detail::get_leaf_unrecorded<I>(record));
+}
+
+template <typename T> using leaf_parser_t = bool (*)(T&, const char*, const char*);
+
+template <typename T, std::size_t... Indices>
+inline std::vector<leaf_parser_t<T>> make_leaf_parsers(index_sequence<Indices...> _)
+{
+  return {&parse_leaf<T, Indices>...};
+}
+
+/**
+ * @brief Splits rows of delimited text into fields, handling RFC-4180 style quoting
+ */
+class Tokenizer
+{
+public:
+  explicit Tokenizer(const char delimiter) : delimiter_{delimiter} {}
+
+  /**
+   * @brief Invokes <code>on_field(column, first, last)</code> for each field of the row starting at \c first
+   *
+   * @return pointer to the start of the next row, or \c nullptr if the row is not terminated before \c last and
+   *         more input is expected (<code>!eof</code>)
+   *
+   * @throws std::runtime_error  on unterminated quoted field at end of input, or on a closing quote which is not
+   *                             followed by a delimiter or the end of the row
+   */
+  template <typename FieldCallbackT>
+  const char* row(const char* first, const char* const last, const bool eof, FieldCallbackT&& on_field)
+  {
+    for (std::size_t column = 0;; ++column)
+    {
+      const char* field_first = first;
+      const char* field_last = nullptr;
+      const char* stop = nullptr;
+
+      if (first != last && *first == '"')
+      {
+        if (!unquote(first + 1, last, eof, stop))
+        {
+          return nullptr;
+        }
+        field_first = scratch_.data();
+        field_last = scratch_.data() + scratch_.size();
+      }
+      else
+      {
+        stop = find_structural(first, last, delimiter_);
+        if (stop == last && !eof)
+        {
+          return nullptr;
+        }
+        field_last = stop;
+        if ((stop == last || *stop == '\n') && field_last != field_first && *(field_last - 1) == '\r')
+        {
+          --field_last;
+        }
+      }
+
+      const bool end_of_row = (stop == last) || (*stop == '\n');
+      on_field(column, field_first, field_last);
+
+      if (stop == last)
+      {
+        return last;
+      }
+      first = stop + 1;
+      if (end_of_row)
+      {
+        return first;
+      }
+    }
+  }
+
+private:
+  /**
+   * @brief Copies a quoted field body into scratch storage, collapsing doubled quotes
+   *
+   * @param[out] stop  character following the closing quote
+   */
+  bool unquote(const char* first, const char* const last, const bool eof, const char*& stop)
+  {
+    scratch_.clear();
+    while (true)
+    {
+      const char* const quote = static_cast<const char*>(std::memchr(first, '"', static_cast<std::size_t>(last - first)));
+      if (quote == nullptr)
+      {
+        if (eof)
+        {
+          throw std::runtime_error{"csv: unterminated quoted field"};
+        }
+        return false;
+      }
+      scratch_.append(first, quote);
+      if (quote + 1 == last)
+      {
+        if (!eof)
+        {
+          return false;
+        }
+        stop = last;
+        return true;
+      }
+      if (quote[1] == '"')
+      {
+        scratch_.push_back('"');
+        first = quote + 2;
+        continue;
+      }
+      stop = quote + 1;
+      if (*stop == '\r')
+      {
+        if (stop + 1 == last && !eof)
+        {
+          return false;
+        }
+        if (stop + 1 != last && stop[1] == '\n')
+        {
+          ++stop;
+        }
+      }
+      if (*stop != delimiter_ && *stop != '\n')
+      {
+        throw std::runtime_error{"csv: unexpected character after closing quote"};
+      }
+      return true;
+    }
+  }
+
+  char delimiter_;
+  std::string scratch_;
+};
+
+/**
+ * @brief Maps CSV columns onto leaf members of \c T and parses rows into records
+ */
+template <typename T> class RowParser
+{
+public:
+  explicit RowParser(const char delimiter) :
+      tokenizer_{delimiter}, parsers_{make_leaf_parsers<T>(make_index_sequence<leaf_count<T>>{})}
+  {}
+
+  bool has_header() const { return !column_to_leaf_.empty(); }
+
+  /**
+   * @brief Parses header row, resolving each column name to a leaf index once
+   *
+   * @return pointer to first data row, or \c nullptr if header is incomplete
+   */
+  const char* header(const char* first, const char* const last, const bool eof)
+  {
+    const auto names = ::about::leaf_names<T>();
+    std::vector<int> mapping;
+    const char* const next = tokenizer_.row(first, last, eof, [&](std::size_t column, const char* f, const char* l) {
+      const auto itr = std::find(names.begin(), names.end(), std::string{f, l});
+      mapping.push_back((itr == names.end()) ? -1 : static_cast<int>(std::distance(names.begin(), itr)));
+    });
+    if (next != nullptr)
+    {
+      column_to_leaf_ = std::move(mapping);
+      row_ = 1;
+    }
+    return next;
+  }
+
+  /**
+   * @brief Parses up to \c max_rows rows, passing each record to \c on_record
+   *
+   * @return pointer to the first unparsed character
+   *
+   * @throws std::runtime_error  if a field could not be converted to its member type
+   */
+  template <typename RecordCallbackT>
+  const char* rows(
+    const char* first,
+    const char* const last,
+    const bool eof,
+    std::size_t max_rows,
+    RecordCallbackT&& on_record)
+  {
+    while (first != last && max_rows != 0)
+    {
+      if (*first == '\n' || (*first == '\r' && first + 1 != last && first[1] == '\n'))
+      {
+        first += (*first == '\n') ? 1 : 2;
+        ++row_;
+        continue;
+      }
+
+      T record{};
+      const char* const next = tokenizer_.row(first, last, eof, [&](std::size_t column, const char* f, const char* l) {
+        if (column < column_to_leaf_.size() && column_to_leaf_[column] >= 0 &&
+            !parsers_[column_to_leaf_[column]](record, f, l))
+        {
+          throw std::runtime_error{
+            "csv: invalid value '" + std::string{f, l} + "' at row " + std::to_string(row_) + ", column " +
+            std::to_string(column)};
+        }
+      });
+      if (next == nullptr)
+      {
+        break;
+      }
+      on_record(std::move(record));
+      first = next;
+      ++row_;
+      --max_rows;
+    }
+    return first;
+  }
+
+private:
+  Tokenizer tokenizer_;
+  std::vector<leaf_parser_t<T>> parsers_;
+  std::vector<int> column_to_leaf_;
+  std::size_t row_ = 0;
+};
+
+/**
+ * @brief Appends a record to each leaf column of a structure-of-arrays layout
+ */
+template <typename T> struct ColumnAppender
+{
+  leaf_vectors_t<T>* columns;
+
+  void operator()(T&& record) const
+  {
+    ::about::detail::for_each_leaf_unrecorded(
+      [this](auto index, auto& leaf) { std::get<decltype(index)::value>(*columns).push_back(std::move(leaf)); },
+      record);
+  }
+};
+
+template <typename T, typename RecordCallbackT>
+inline void read(const char* first, const char* const last, const char delimiter, RecordCallbackT&& on_record)
+{
+  RowParser<T> parser{delimiter};
+  first = parser.header(first, last, true);
+  parser.rows(first, last, true, std::numeric_limits<std::size_t>::max(), std::forward<RecordCallbackT>(on_record));
+}
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Parses in-memory CSV text into records of reflected type \c T
+ *
+ * The first row is a header. Each header column is matched, once, against the flattened leaf member names of \c T
+ * (see <code>leaf_names</code>, e.g. <code>"d.a.real_number"</code>); unmatched columns are skipped, and members
+ * without a column (or with an empty field) are left value-initialized.
+ *
+ * Supports arithmetic, enum (by underlying value), <code>bool</code> and <code>std::string</code> leaves. Floating
+ * point fields are decimal, with a '.' separator, regardless of the global locale; \c inf, \c nan and hexadecimal
+ * forms are rejected.
+ *
+ * @param data  CSV text
+ * @param size  length of \c data, in bytes
+ * @param delimiter  field delimiter
+ *
+ * @throws std::runtime_error  if a field could not be converted to its member type
+ */
+template <typename T> std::vector<T> read(const char* data, const std::size_t size, const char delimiter = ',')
+{
+  std::vector<T> records;
+  detail::read<T>(data, data + size, delimiter, [&records](T&& record) { records.emplace_back(std::move(record)); });
+  return records;
+}
+
+/**
+ * @copydoc read
+ */
+template <typename T> std::vector<T> read(const std::string& text, const char delimiter = ',')
+{
+  return read<T>(text.data(), text.size(), delimiter);
+}
+
+/**
+ * @brief Parses in-memory CSV text directly into one column per leaf member of \c T
+ *
+ * Same column-matching rules as <code>read</code>
+ *
+ * @return structure-of-arrays; <code>std::get<I></code> holds values of leaf \c I
+ */
+template <typename T>
+leaf_vectors_t<T> read_columns(const char* data, const std::size_t size, const char delimiter = ',')
+{
+  leaf_vectors_t<T> columns;
+  detail::read<T>(data, data + size, delimiter, detail::ColumnAppender<T>{std::addressof(columns)});
+  return columns;
+}
+
+/**
+ * @brief Incrementally parses CSV from a stream, for inputs which do not fit in memory
+ *
+ * @code{.cpp}
+ * std::ifstream ifs{"huge.csv"};
+ * csv::reader<my_ns::MyClass> reader{ifs};
+ * std::vector<my_ns::MyClass> batch;
+ * while (reader.read(batch, 4096) > 0)
+ * {
+ *   consume(batch);
+ *   batch.clear();
+ * }
+ * @endcode
+ */
+template <typename T> class reader
+{
+public:
+  /**
+   * @param is  input stream, positioned at the header row
+   * @param delimiter  field delimiter
+   * @param buffer_size  initial size of the read buffer; grows if a single row does not fit
+   */
+  explicit reader(std::istream& is, const char delimiter = ',', const std::size_t buffer_size = 1UL << 20) :
+      is_{std::addressof(is)}, parser_{delimiter}, buffer_(std::max<std::size_t>(buffer_size, 64UL))
+  {}
+
+  /**
+   * @brief Appends up to \c max_rows records to \c records
+   *
+   * @return number of records appended; \c 0 once input is exhausted
+   *
+   * @throws std::runtime_error  if a field could not be converted to its member type
+   */
+  std::size_t read(std::vector<T>& records, const std::size_t max_rows)
+  {
+    return read_with(max_rows, [&records](T&& record) { records.emplace_back(std::move(record)); });
+  }
+
+  /**
+   * @brief Appends up to \c max_rows records to \c columns, one column per leaf member
+   *
+   * @copydetails read
+   */
+  std::size_t read(leaf_vectors_t<T>& columns, const std::size_t max_rows)
+  {
+    return read_with(max_rows, detail::ColumnAppender<T>{std::addressof(columns)});
+  }
+
+private:
+  template <typename RecordCallbackT> std::size_t read_with(const std::size_t max_rows, RecordCallbackT on_record)
+  {
+    std::size_t count = 0;
+    auto counted = [&count, &on_record](T&& record) {
+      on_record(std::move(record));
+      ++count;
+    };
+
+    while (count < max_rows)
+    {
+      const char* const first = buffer_.data() + begin_;
+      const char* const last = buffer_.data() + end_;
+      const char* next = nullptr;
+      if (!parser_.has_header())
+      {
+        next = parser_.header(first, last, eof_);
+      }
+      else
+      {
+        next = parser_.rows(first, last, eof_, max_rows - count, counted);
+      }
+
+      if (next != nullptr && next != first)
+      {
+        begin_ = static_cast<std::size_t>(next - buffer_.data());
+        continue;
+      }
+      if (eof_)
+      {
+        break;
+      }
+      fill();
+    }
+    return count;
+  }
+
+  /// Moves unparsed bytes to front of buffer (growing it if full) and reads more input
+  void fill()
+  {
+    const std::size_t remaining = end_ - begin_;
+    std::memmove(buffer_.data(), buffer_.data() + begin_, remaining);
+    begin_ = 0;
+    end_ = remaining;
+    if (end_ == buffer_.size())
+    {
+      buffer_.resize(buffer_.size() * 2);
+    }
+    is_->read(buffer_.data() + end_, static_cast<std::streamsize>(buffer_.size() - end_));
+    end_ += static_cast<std::size_t>(is_->gcount());
+    eof_ = !(*is_);
+  }
+
+  std::istream* is_;
+  detail::RowParser<T> parser_;
+  std::vector<char> buffer_;
+  std::size_t begin_ = 0;
+  std::size_t end_ = 0;
+  bool eof_ = false;
+};
+
+}  // namespace csv
+}  // namespace about
+
+#endif  // ABOUT_CSV_HPP
@@ -0,0 +1,328 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_DEEP_SIZE_HPP
+#define ABOUT_DEEP_SIZE_HPP
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// About
+#include <about/about.hpp>
+#include <about/flatten.hpp>
+#include <about/integer_sequence.hpp>
+#include <about/var.hpp>
+
+namespace about
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+template <typename T> std::size_t heap_bytes(const T& value);
+
+template <typename T> std::size_t default_heap_bytes(const T& value, std::false_type _) { return 0; }
+
+template <typename VarsTupleT, std::size_t... Is>
+std::size_t member_heap_bytes(const VarsTupleT& vars, index_sequence<Is...> _)
+{
+  std::size_t total = 0;
+  [[maybe_unused]] const auto __list = std::initializer_list<int>{0, (total += heap_bytes(std::get<Is>(vars)), 0)...};
+  return total;
+}
+
+template <typename T> std::size_t default_heap_bytes(const T& value, std::true_type _)
+{
+  return member_heap_bytes(
+    ::about::detail::get_public_vars_unrecorded(value),
+    make_index_sequence<std::tuple_size<public_var_info_t<T>>::value>{});
+}
+
+/// Heap bytes owned by elements of <code>[first, last)</code>; scalars own none, so are not visited
+template <typename IteratorT> std::size_t element_heap_bytes(IteratorT first, IteratorT last, std::true_type _)
+{
+  return 0;
+}
+
+template <typename IteratorT> std::size_t element_heap_bytes(IteratorT first, IteratorT last, std::false_type _)
+{
+  std::size_t total = 0;
+  for (; first != last; ++first)
+  {
+    total += heap_bytes(*first);
+  }
+  return total;
+}
+
+template <typename IteratorT> std::size_t element_heap_bytes(IteratorT first, IteratorT last)
+{
+  using ValueT = typename std::iterator_traits<IteratorT>::value_type;
+  return element_heap_bytes(first, last, std::is_scalar<ValueT>{});
+}
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Customization point which reports heap memory owned by a value of type \c T
+ *
+ * By default, reflected classes report the sum over their public members, and all other types report zero.
+ * Specializations are provided for <code>std::basic_string</code>, <code>std::vector</code>, <code>std::array</code>
+ * and <code>std::pair</code>. Specialize this for user containers:
+ *
+ * @code{.cpp}
+ * namespace about
+ * {
+ * template <typename T> struct deep_size_traits<my_ns::RingBuffer<T>>
+ * {
+ *   static std::size_t heap_bytes(const my_ns::RingBuffer<T>& buffer)
+ *   {
+ *     return buffer.capacity() * sizeof(T);
+ *   }
+ * };
+ * }  // namespace about
+ * @endcode
+ *
+ * @tparam T  type to measure
+ */
+template <typename T, typename Enable = void> struct deep_size_traits
+{
+  static std::size_t heap_bytes(const T& value)
+  {
+    return detail::default_heap_bytes(value, std::integral_constant<bool, is_reflected_class<T>>{});
+  }
+};
+
+template <typename CharT, typename TraitsT, typename AllocatorT>
+struct deep_size_traits<std::basic_string<CharT, TraitsT, AllocatorT>>
+{
+  static std::size_t heap_bytes(const std::basic_string<CharT, TraitsT, AllocatorT>& value)
+  {
+    // Short strings are stored within the string object itself
+    const auto* data = reinterpret_cast<const char*>(value.data());
+    const auto* first = reinterpret_cast<const char*>(std::addressof(value));
+    const auto* last = first + sizeof(value);
+    const std::less<const char*> less;
+    if (!less(data, first) && less(data, last))
+    {
+      return 0;
+    }
+    return (value.capacity() + 1) * sizeof(CharT);
+  }
+};
+
+template <typename T, typename AllocatorT> struct deep_size_traits<std::vector<T, AllocatorT>>
+{
+  static std::size_t heap_bytes(const std::vector<T, AllocatorT>& value)
+  {
+    return value.capacity() * sizeof(T) + detail::element_heap_bytes(value.begin(), value.end());
+  }
+};
+
+template <typename AllocatorT> struct deep_size_traits<std::vector<bool, AllocatorT>>
+{
+  static std::size_t heap_bytes(const std::vector<bool, AllocatorT>& value)
+  {
+    return (value.capacity() + CHAR_BIT - 1) / CHAR_BIT;
+  }
+};
+
+template <typename T, std::size_t N> struct deep_size_traits<std::array<T, N>>
+{
+  static std::size_t heap_bytes(const std::array<T, N>& value)
+  {
+    return detail::element_heap_bytes(value.begin(), value.end());
+  }
+};
+
+template <typename FirstT, typename SecondT> struct deep_size_traits<std::pair<FirstT, SecondT>>
+{
+  static std::size_t heap_bytes(const std::pair<FirstT, SecondT>& value)
+  {
+    return deep_size_traits<FirstT>::heap_bytes(value.first) + deep_size_traits<SecondT>::heap_bytes(value.second);
+  }
+};
+
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+template <typename T> std::size_t heap_bytes(const T& value) { return deep_size_traits<T>::heap_bytes(value); }
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Returns bytes held by \c value: its own size, plus heap memory owned by it and its members, recursively
+ *
+ * @code{.cpp}
+ * memory_gauge.set(about::deep_size(cache_entry));
+ * @endcode
+ *
+ * Heap bytes are those requested from allocators (e.g. <code>capacity()</code> of containers), not including
+ * allocator bookkeeping. Only public members of reflected classes are walked: heap memory owned by private or
+ * protected members is not counted, unless <code>deep_size_traits</code> is specialized for the class.
+ */
+template <typename T> std::size_t deep_size(const T& value) { return sizeof(T) + detail::heap_bytes(value); }
+
+/**
+ * @brief Returns the sum of <code>deep_size</code> over all values in <code>[first, last)</code>
+ *
+ * @code{.cpp}
+ * const auto bytes = about::deep_size(entries.begin(), entries.end());
+ * @endcode
+ */
+template <typename IteratorT> std::size_t deep_size(IteratorT first, IteratorT last)
+{
+  using ValueT = typename std::iterator_traits<IteratorT>::value_type;
+  return static_cast<std::size_t>(std::distance(first, last)) * sizeof(ValueT) +
+    detail::element_heap_bytes(first, last);
+}
+
+/**
+ * @brief Bytes held by each leaf member, summed over many reflected objects
+ *
+ * Each leaf (see <code>leaf_names</code>) is charged its own size plus the heap memory it owns. Only public members
+ * are walked: bytes of a reflected object not covered by any public leaf, i.e. its padding and the inline bytes of
+ * its private and protected members, are reported by <code>unaccounted()</code>, and heap memory owned by private
+ * or protected members is not counted at all.
+ *
+ * @code{.cpp}
+ * about::deep_size_breakdown<Order> breakdown;
+ * breakdown.add(orders.begin(), orders.end());
+ * for (std::size_t i = 0; i < breakdown.size; ++i)
+ * {
+ *   metrics.gauge("orders.bytes." + breakdown.names()[i]).set(breakdown[i]);
+ * }
+ * @endcode
+ *
+ * @tparam T  reflected class type
+ */
+template <typename T> class deep_size_breakdown
+{
+  static_assert(is_reflected_class<T>, "deep_size_breakdown requires a reflected class type");
+
+public:
+  /// Number of leaf members
+  static constexpr std::size_t size = leaf_count<T>;
+
+  deep_size_breakdown() { bytes_.fill(0); }
+
+  /**
+   * @brief Adds bytes held by members of \c value
+   */
+  void add(const T& value)
+  {
+    ++count_;
+    ::about::detail::for_each_leaf_unrecorded(
+      [this](auto index, const auto& leaf) {
+        bytes_[decltype(index)::value] += sizeof(leaf) + detail::heap_bytes(leaf);
+      },
+      value);
+  }
+
+  /**
+   * @brief Adds bytes held by members of all values in <code>[first, last)</code>
+   */
+  template <typename IteratorT> void add(IteratorT first, IteratorT last)
+  {
+    for (; first != last; ++first)
+    {
+      add(*first);
+    }
+  }
+
+  /**
+   * @brief Returns names of leaf members, as in <code>leaf_names<T>()</code>
+   */
+  static const std::vector<std::string>& names()
+  {
+    static const std::vector<std::string> kNames = leaf_names<T>();
+    return kNames;
+  }
+
+  /**
+   * @brief Returns bytes held by the \c i th leaf member
+   */
+  std::size_t operator[](const std::size_t i) const { return bytes_[i]; }
+
+  /**
+   * @brief Returns bytes held by the leaf member with flattened name \c name, e.g. <code>"d.a.real_number"</code>
+   *
+   * @throws std::out_of_range  if no leaf member has this name
+   */
+  std::size_t at(const std::string& name) const
+  {
+    const auto& all = names();
+    const auto itr = std::find(all.begin(), all.end(), name);
+    if (itr == all.end())
+    {
+      throw std::out_of_range{"deep_size_breakdown: no leaf member named " + name};
+    }
+    return bytes_[static_cast<std::size_t>(itr - all.begin())];
+  }
+
+  /**
+   * @brief Returns bytes held by a leaf member named by tag, e.g. <code>"symbol"_var</code>, resolved at compile-time
+   */
+  template <char... Chars> std::size_t get(detail::VarName<Chars...> tag) const { return bytes_[leaf_index<T>(tag)]; }
+
+  /**
+   * @brief Returns number of objects added
+   */
+  std::size_t count() const { return count_; }
+
+  /**
+   * @brief Returns bytes held by all objects added; equal to the sum of <code>deep_size</code> of each
+   */
+  std::size_t total() const
+  {
+    std::size_t sum = unaccounted();
+    for (const auto bytes : bytes_)
+    {
+      sum += bytes;
+    }
+    return sum;
+  }
+
+  /**
+   * @brief Returns inline bytes of objects added which are not part of any public leaf member: padding, and private
+   *        or protected members
+   */
+  std::size_t unaccounted() const { return count_ * kUnaccountedPerObject; }
+
+private:
+  template <std::size_t... Is> static constexpr std::size_t leaf_bytes(index_sequence<Is...> _)
+  {
+    std::size_t total = 0;
+    for (const auto size : {std::size_t{0}, sizeof(std::tuple_element_t<Is, leaf_types_t<T>>)...})
+    {
+      total += size;
+    }
+    return total;
+  }
+
+  static constexpr std::size_t kUnaccountedPerObject = sizeof(T) - leaf_bytes(make_index_sequence<size>{});
+
+  std::array<std::size_t, size> bytes_;
+  std::size_t count_ = 0;
+};
+
+template <typename T> constexpr std::size_t deep_size_breakdown<T>::size;
+
+}  // namespace about
+
+#endif  // ABOUT_DEEP_SIZE_HPP
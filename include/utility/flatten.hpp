@@ -0,0 +1,378 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_FLATTEN_HPP
+#define ABOUT_FLATTEN_HPP
+
+// C++ Standard Library
+#include <initializer_list>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// About
+#include <about/about.hpp>
+#include <about/for_each.hpp>
+#include <about/integer_sequence.hpp>
+#include <about/var.hpp>
+
+namespace about
+{
+
+/**
+ * @brief Checks if \c T is a class type with generated public member information
+ *
+ * Unlike <code>has_reflection_info</code>, this is \c false for reflected enumerations, which have names but no
+ * members to traverse.
+ *
+ * @tparam T  type to check
+ */
+template <typename T>
+constexpr bool is_reflected_class = std::is_class<detail::cleaned_t<T>>::value && has_reflection_info<T>;
+
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/**
+ * @brief Collects the types of all non-reflected (leaf) members of \c T, depth-first, in order of declaration
+ */
+template <typename T, typename Enable = void> struct LeafTypes
+{
+  using type = std::tuple<T>;
+};
+
+/**
+ * @copydoc LeafTypes
+ *
+ * Concatenates leaves of each member described by a <code>public_var_info</code> tuple
+ */
+template <typename InfoTupleT> struct MemberLeafTypes;
+
+template <typename... InfoTs> struct MemberLeafTypes<std::tuple<InfoTs...>>
+{
+  using type = decltype(std::tuple_cat(std::declval<typename LeafTypes<typename InfoTs::type>::type>()...));
+};
+
+/**
+ * @copydoc LeafTypes
+ *
+ * Reflected class case
+ */
+template <typename T> struct LeafTypes<T, std::enable_if_t<is_reflected_class<T>>>
+{
+  using type = typename MemberLeafTypes<public_var_info_t<T>>::type;
+};
+
+/**
+ * @brief Sums the first \c n elements of \c counts
+ */
+constexpr std::size_t partial_sum(std::initializer_list<std::size_t> counts, const std::size_t n)
+{
+  std::size_t sum = 0;
+  std::size_t i = 0;
+  for (const auto c : counts)
+  {
+    if (i++ == n)
+    {
+      break;
+    }
+    sum += c;
+  }
+  return sum;
+}
+
+/**
+ * @brief Index of the first leaf of the \c I th member described by a <code>public_var_info</code> tuple
+ */
+template <typename InfoTupleT, std::size_t I> struct MemberLeafOffset;
+
+template <typename... InfoTs, std::size_t I> struct MemberLeafOffset<std::tuple<InfoTs...>, I>
+{
+  static constexpr std::size_t value =
+    partial_sum({std::tuple_size<typename LeafTypes<typename InfoTs::type>::type>::value...}, I);
+};
+
+/**
+ * @brief Index of the member whose leaves contain the \c n th leaf, given per-member leaf \c counts
+ */
+constexpr std::size_t member_containing_leaf(std::initializer_list<std::size_t> counts, const std::size_t n)
+{
+  std::size_t sum = 0;
+  std::size_t i = 0;
+  for (const auto c : counts)
+  {
+    if (n < sum + c)
+    {
+      return i;
+    }
+    sum += c;
+    ++i;
+  }
+  return i;
+}
+
+/**
+ * @brief Index of the member described by a <code>public_var_info</code> tuple which contains leaf \c I
+ */
+template <typename InfoTupleT, std::size_t I> struct MemberContainingLeaf;
+
+template <typename... InfoTs, std::size_t I> struct MemberContainingLeaf<std::tuple<InfoTs...>, I>
+{
+  static constexpr std::size_t value =
+    member_containing_leaf({std::tuple_size<typename LeafTypes<typename InfoTs::type>::type>::value...}, I);
+  static_assert(value < sizeof...(InfoTs), "leaf index out of range");
+};
+
+/**
+ * @brief Checks, at compile-time, if leaf \c I of \c T has a flattened name, e.g. <code>"d.a.real_number"</code>
+ *
+ * Each member of \c T consumes its own name from \c name, and a <code>'.'</code> if it is a reflected class
+ */
+template <typename T, std::size_t I, typename Enable = void> struct LeafNameMatches
+{
+  static constexpr bool match(const char* name) { return *name == '\0'; }
+};
+
+template <typename T, std::size_t I> struct LeafNameMatches<T, I, std::enable_if_t<is_reflected_class<T>>>
+{
+  using InfoTupleT = public_var_info_t<T>;
+  static constexpr std::size_t J = MemberContainingLeaf<InfoTupleT, I>::value;
+  using MemberT = typename std::tuple_element_t<J, InfoTupleT>::type;
+
+  static constexpr bool match(const char* name)
+  {
+    const char* member = std::tuple_element_t<J, InfoTupleT>::name;
+    while (*member != '\0' && *member == *name)
+    {
+      ++member;
+      ++name;
+    }
+    if (*member != '\0' || (is_reflected_class<MemberT> && *name++ != '.'))
+    {
+      return false;
+    }
+    return LeafNameMatches<MemberT, I - MemberLeafOffset<InfoTupleT, J>::value>::match(name);
+  }
+};
+
+/// Index of the first element of \c matches which is \c true, or <code>matches.size()</code>
+constexpr std::size_t first_match(std::initializer_list<bool> matches)
+{
+  std::size_t i = 0;
+  for (const bool match : matches)
+  {
+    if (match)
+    {
+      return i;
+    }
+    ++i;
+  }
+  return i;
+}
+
+/// Index of the leaf of \c T whose flattened name is spelled by \c TagT, or the number of leaves
+template <
+  typename T,
+  typename TagT,
+  typename Indices = make_index_sequence<std::tuple_size<typename LeafTypes<T>::type>::value>>
+struct LeafIndex;
+
+template <typename T, typename TagT, std::size_t... Is> struct LeafIndex<T, TagT, index_sequence<Is...>>
+{
+  static constexpr std::size_t value =
+    first_match(std::initializer_list<bool>{LeafNameMatches<T, Is>::match(TagString<TagT>::value)...});
+  static constexpr bool found = value < sizeof...(Is);
+};
+
+/// One <code>std::vector</code> per element of a tuple of leaf types
+template <typename LeafTupleT> struct LeafVectors;
+
+template <typename... LeafTs> struct LeafVectors<std::tuple<LeafTs...>>
+{
+  using type = std::tuple<std::vector<LeafTs>...>;
+};
+
+template <std::size_t I, typename ValueT, typename RecordT>
+inline decltype(auto) get_leaf(ValueT&& value, std::false_type _, RecordT record)
+{
+  static_assert(I == 0, "leaf index out of range");
+  return std::forward<ValueT>(value);
+}
+
+template <std::size_t I, typename ValueT, typename RecordT>
+inline decltype(auto) get_leaf(ValueT&& value, std::true_type _, RecordT record)
+{
+  using InfoTupleT = public_var_info_t<ValueT>;
+  constexpr std::size_t J = MemberContainingLeaf<InfoTupleT, I>::value;
+  using MemberT = typename std::tuple_element_t<J, InfoTupleT>::type;
+  ABOUT_RECORD_FIELD_ACCESS_IF(RecordT::value, cleaned_t<ValueT>, value, member_mask<J>());
+  return get_leaf<I - MemberLeafOffset<InfoTupleT, J>::value>(
+    std::get<J>(get_public_vars_unrecorded(value)),
+    std::integral_constant<bool, is_reflected_class<MemberT>>{},
+    record);
+}
+
+template <std::size_t Offset, typename CallbackT, typename ValueT, typename RecordT>
+inline std::enable_if_t<!is_reflected_class<ValueT>> for_each_leaf(CallbackT& cb, ValueT&& value, RecordT record)
+{
+  cb(std::integral_constant<std::size_t, Offset>{}, std::forward<ValueT>(value));
+}
+
+template <std::size_t Offset, typename CallbackT, typename ValueT, typename RecordT>
+inline std::enable_if_t<is_reflected_class<ValueT>> for_each_leaf(CallbackT& cb, ValueT&& value, RecordT record);
+
+template <
+  std::size_t Offset,
+  typename InfoTupleT,
+  typename CallbackT,
+  typename VarsTupleT,
+  typename RecordT,
+  std::size_t... Indices>
+inline void for_each_leaf_member(CallbackT& cb, VarsTupleT&& vars, RecordT record, index_sequence<Indices...> _)
+{
+  [[maybe_unused]] const auto __list = std::initializer_list<int>{
+    0,
+    (for_each_leaf<Offset + MemberLeafOffset<InfoTupleT, Indices>::value>(cb, std::get<Indices>(vars), record),
+     1)...};
+}
+
+template <std::size_t Offset, typename CallbackT, typename ValueT, typename RecordT>
+inline std::enable_if_t<is_reflected_class<ValueT>> for_each_leaf(CallbackT& cb, ValueT&& value, RecordT record)
+{
+  using InfoTupleT = public_var_info_t<ValueT>;
+  ABOUT_RECORD_FIELD_ACCESS_IF(RecordT::value, cleaned_t<ValueT>, value, all_members_mask<cleaned_t<ValueT>>());
+  for_each_leaf_member<Offset, InfoTupleT>(
+    cb, get_public_vars_unrecorded(value), record, make_index_sequence<std::tuple_size<InfoTupleT>::value>{});
+}
+
+/// Like <code>about::get_leaf</code>, without recording the access; for use by About utilities
+template <std::size_t I, typename T> inline decltype(auto) get_leaf_unrecorded(T&& value)
+{
+  return get_leaf<I>(std::forward<T>(value), std::integral_constant<bool, is_reflected_class<T>>{}, std::false_type{});
+}
+
+/// Like <code>about::for_each_leaf</code>, without recording the access; for use by About utilities
+template <typename CallbackT, typename T> inline void for_each_leaf_unrecorded(CallbackT&& cb, T&& value)
+{
+  for_each_leaf<0>(cb, std::forward<T>(value), std::false_type{});
+}
+
+template <typename T>
+inline std::enable_if_t<!is_reflected_class<T>>
+append_leaf_names(std::vector<std::string>& names, const std::string& prefix, const char* separator)
+{
+  names.emplace_back(prefix);
+}
+
+template <typename T>
+inline std::enable_if_t<is_reflected_class<T>>
+append_leaf_names(std::vector<std::string>& names, const std::string& prefix, const char* separator)
+{
+  ::about::for_each(
+    [&names, &prefix, separator](auto info) {
+      using InfoT = decltype(info);
+      append_leaf_names<typename InfoT::type>(
+        names, prefix.empty() ? std::string{InfoT::name} : (prefix + separator + InfoT::name), separator);
+    },
+    public_var_info_t<T>{});
+}
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief <code>std::tuple</code> of the types of all leaf members of \c T, depth-first, in order of declaration
+ *
+ * A leaf is any public member which is not itself a reflected class; reflected class members are expanded in place.
+ *
+ * @tparam T  type to reflect
+ */
+template <typename T> using leaf_types_t = typename detail::LeafTypes<detail::cleaned_t<T>>::type;
+
+/**
+ * @brief Number of leaf members of \c T
+ *
+ * @tparam T  type to reflect
+ */
+template <typename T> constexpr std::size_t leaf_count = std::tuple_size<leaf_types_t<T>>::value;
+
+/**
+ * @brief <code>std::tuple</code> with one <code>std::vector</code> per leaf member of \c T (structure-of-arrays layout)
+ *
+ * @tparam T  type to reflect
+ */
+template <typename T> using leaf_vectors_t = typename detail::LeafVectors<leaf_types_t<T>>::type;
+
+/**
+ * @brief Returns a reference to the \c I th leaf member of \c value, resolved entirely at compile-time
+ *
+ * @code{.cpp}
+ * get_leaf<3>(my_class) = 1.f;  // my_class.d.a.real_number = 1.f
+ * @endcode
+ */
+template <std::size_t I, typename T> inline decltype(auto) get_leaf(T&& value)
+{
+  static_assert(I < leaf_count<T>, "leaf index out of range");
+  return detail::get_leaf<I>(
+    std::forward<T>(value), std::integral_constant<bool, is_reflected_class<T>>{}, std::true_type{});
+}
+
+/**
+ * @brief Invokes a callback, \c cb, for each leaf member of \c value, depth-first, in order of declaration
+ *
+ * Callback is given the flattened index of the leaf as a <code>std::integral_constant</code>
+ * @code{.cpp}
+ * for_each_leaf(
+ *   [](auto index, const auto& leaf)
+ *   {
+ *     using LeafT = std::tuple_element_t<decltype(index)::value, leaf_types_t<T>>;
+ *   },
+ *   value
+ * );
+ * @endcode
+ *
+ * Leaves are passed by non-const reference when \c value is a non-const lvalue.
+ */
+template <typename CallbackT, typename T> inline void for_each_leaf(CallbackT&& cb, T&& value)
+{
+  detail::for_each_leaf<0>(cb, std::forward<T>(value), std::true_type{});
+}
+
+/**
+ * @brief Returns names of all leaf members of \c T, joined with their enclosing member names by \c separator
+ *
+ * e.g. <code>{"a", "b", "c", "d.a.real_number", "d.b.real_number"}</code>
+ *
+ * @tparam T  type to reflect
+ */
+template <typename T> std::vector<std::string> leaf_names(const char* separator = ".")
+{
+  std::vector<std::string> names;
+  names.reserve(leaf_count<T>);
+  detail::append_leaf_names<detail::cleaned_t<T>>(names, std::string{}, separator);
+  return names;
+}
+
+/**
+ * @brief Index of the leaf member of \c T named by a tag, as in <code>leaf_names<T>()</code>, resolved at compile-time
+ *
+ * @code{.cpp}
+ * static_assert(about::leaf_index<my_ns::MyClass>("d.a.real_number"_var) == 3, "");
+ * @endcode
+ *
+ * @tparam T  reflected class type
+ */
+template <typename T, char... Chars> constexpr std::size_t leaf_index(detail::VarName<Chars...> _)
+{
+  static_assert(
+    detail::LeafIndex<detail::cleaned_t<T>, detail::VarName<Chars...>>::found, "no leaf member with this name");
+  return detail::LeafIndex<detail::cleaned_t<T>, detail::VarName<Chars...>>::value;
+}
+
+}  // namespace about
+
+#endif  // ABOUT_FLATTEN_HPP
@@ -7,6 +7,7 @@
 #define ABOUT_FMT_HPP
 
 // C++ Standard Library
+#include <iomanip>
 #include <ostream>
 #include <type_traits>
 #include <utility>
@@ -49,7 +50,7 @@ fmt_print(std::ostream& os, ValueT&& value, const std::size_t justification = Ju
   ::about::for_each_enumerated(
     ::about::detail::Printer<Justification>{os, justification},
     ::about::public_var_info_t<ValueT>{},
-    ::about::get_public_vars(std::forward<ValueT>(value)));
+    ::about::detail::get_public_vars_unrecorded(std::forward<ValueT>(value)));
   os << "\n";
   os << std::setw(justification - Justification) << '}';
 }
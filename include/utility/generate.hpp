@@ -0,0 +1,565 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_GENERATE_HPP
+#define ABOUT_GENERATE_HPP
+
+// C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// About
+#include <about/about.hpp>
+#include <about/flatten.hpp>
+#include <about/integer_sequence.hpp>
+
+namespace about
+{
+
+/**
+ * @brief Distribution used to generate one field
+ *
+ * For arithmetic and enum fields, describes the value. For <code>std::string</code> and <code>std::vector</code>
+ * fields, describes the length.
+ */
+struct field_distribution
+{
+  enum class kind
+  {
+    uniform,
+    normal
+  };
+
+  kind type;
+  double a;
+  double b;
+
+  /// Values uniformly distributed over <code>[min, max]</code>
+  static constexpr field_distribution uniform(const double min, const double max)
+  {
+    return field_distribution{kind::uniform, min, max};
+  }
+
+  /// Values normally distributed (integers are rounded)
+  static constexpr field_distribution normal(const double mean, const double stddev)
+  {
+    return field_distribution{kind::normal, mean, stddev};
+  }
+
+  /// Always \c value
+  static constexpr field_distribution constant(const double value) { return uniform(value, value); }
+};
+
+/**
+ * @brief Per-field and per-kind distributions used by <code>generate</code>
+ *
+ * @code{.cpp}
+ * about::generate_config config;
+ * config.set("price"_var, about::field_distribution::normal(100.0, 5.0))
+ *       .set("d.a.real_number", about::field_distribution::constant(1.0))
+ *       .string_length(4, 32);
+ * @endcode
+ *
+ * Fields are looked up by their flattened name (see <code>leaf_names</code>), then by their own member name, so
+ * <code>"real_number"_var</code> applies to every member called \c real_number. Fields without an entry use the
+ * default for their kind.
+ */
+class generate_config
+{
+public:
+  /**
+   * @brief Sets distribution of fields named \c name
+   */
+  generate_config& set(const std::string& name, const field_distribution distribution)
+  {
+    fields_[name] = distribution;
+    return *this;
+  }
+
+  /**
+   * @brief Sets distribution of fields named by tag, e.g. <code>"price"_var</code>
+   */
+  template <char... Chars> generate_config& set(detail::VarName<Chars...> _, const field_distribution distribution)
+  {
+    return set(std::string{Chars...}, distribution);
+  }
+
+  /// Default distribution of integer fields
+  generate_config& integral(const field_distribution distribution)
+  {
+    integral_ = distribution;
+    return *this;
+  }
+
+  /// Default distribution of floating point fields
+  generate_config& floating(const field_distribution distribution)
+  {
+    floating_ = distribution;
+    return *this;
+  }
+
+  /// Default (uniform) length range of <code>std::string</code> fields
+  generate_config& string_length(const std::size_t min, const std::size_t max)
+  {
+    string_length_ = field_distribution::uniform(static_cast<double>(min), static_cast<double>(max));
+    return *this;
+  }
+
+  /// Default (uniform) size range of <code>std::vector</code> fields
+  generate_config& container_size(const std::size_t min, const std::size_t max)
+  {
+    container_size_ = field_distribution::uniform(static_cast<double>(min), static_cast<double>(max));
+    return *this;
+  }
+
+  /**
+   * @brief Returns distribution for field \c name, or \c fallback if none was set
+   */
+  field_distribution lookup(const std::string& name, const field_distribution fallback) const
+  {
+    auto itr = fields_.find(name);
+    if (itr == fields_.end())
+    {
+      const auto dot = name.rfind('.');
+      if (dot != std::string::npos)
+      {
+        itr = fields_.find(name.substr(dot + 1));
+      }
+    }
+    return (itr == fields_.end()) ? fallback : itr->second;
+  }
+
+  field_distribution integral() const { return integral_; }
+  field_distribution floating() const { return floating_; }
+  field_distribution string_length() const { return string_length_; }
+  field_distribution container_size() const { return container_size_; }
+
+private:
+  std::unordered_map<std::string, field_distribution> fields_;
+  field_distribution integral_ = field_distribution::uniform(-1000.0, 1000.0);
+  field_distribution floating_ = field_distribution::uniform(0.0, 1.0);
+  field_distribution string_length_ = field_distribution::uniform(0.0, 16.0);
+  field_distribution container_size_ = field_distribution::uniform(0.0, 8.0);
+};
+
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+template <typename T> struct IsVector : std::false_type
+{};
+
+template <typename T, typename AllocatorT> struct IsVector<std::vector<T, AllocatorT>> : std::true_type
+{};
+
+/**
+ * @brief Distributions resolved for every leaf of a type, plus plans for elements of container leaves
+ */
+struct GeneratePlan
+{
+  static constexpr std::size_t kNoChild = std::numeric_limits<std::size_t>::max();
+
+  struct Leaf
+  {
+    field_distribution distribution;
+    std::size_t child;
+  };
+
+  std::vector<Leaf> leaves;
+  std::vector<GeneratePlan> children;
+};
+
+template <typename T> GeneratePlan build_plan(const generate_config& config, const std::string& prefix);
+
+template <typename LeafT>
+std::enable_if_t<std::is_same<LeafT, bool>::value, field_distribution> default_distribution(const generate_config& config)
+{
+  return field_distribution::uniform(0.0, 1.0);
+}
+
+template <typename LeafT>
+std::enable_if_t<std::is_integral<LeafT>::value && !std::is_same<LeafT, bool>::value, field_distribution>
+default_distribution(const generate_config& config)
+{
+  return config.integral();
+}
+
+template <typename LeafT>
+std::enable_if_t<std::is_floating_point<LeafT>::value, field_distribution> default_distribution(const generate_config& config)
+{
+  return config.floating();
+}
+
+template <typename LeafT>
+std::enable_if_t<std::is_same<LeafT, std::string>::value, field_distribution> default_distribution(const generate_config& config)
+{
+  return config.string_length();
+}
+
+template <typename LeafT>
+std::enable_if_t<IsVector<LeafT>::value, field_distribution> default_distribution(const generate_config& config)
+{
+  return config.container_size();
+}
+
+/**
+ * @brief Enums with generated meta information are uniform over their smallest to largest enumerator; others use the
+ *        default integer distribution
+ */
+template <typename EnumT, typename Enable = void> struct EnumDistribution
+{
+  static field_distribution get(const generate_config& config) { return config.integral(); }
+};
+
+template <typename EnumT> struct EnumDistribution<EnumT, decltype(void(ClassMetaInfo<EnumT>::min_value))>
+{
+  static field_distribution get(const generate_config& config)
+  {
+    return field_distribution::uniform(
+      static_cast<double>(ClassMetaInfo<EnumT>::min_value), static_cast<double>(ClassMetaInfo<EnumT>::max_value));
+  }
+};
+
+template <typename LeafT>
+std::enable_if_t<std::is_enum<LeafT>::value, field_distribution> default_distribution(const generate_config& config)
+{
+  return EnumDistribution<LeafT>::get(config);
+}
+
+template <typename LeafT>
+std::enable_if_t<
+  !std::is_arithmetic<LeafT>::value && !std::is_enum<LeafT>::value && !std::is_same<LeafT, std::string>::value &&
+    !IsVector<LeafT>::value,
+  field_distribution>
+default_distribution(const generate_config& config)
+{
+  return field_distribution::constant(0.0);
+}
+
+template <typename LeafT>
+std::enable_if_t<!IsVector<LeafT>::value> add_child_plan(GeneratePlan& plan, const generate_config& config, const std::string& name)
+{}
+
+template <typename LeafT>
+std::enable_if_t<IsVector<LeafT>::value> add_child_plan(GeneratePlan& plan, const generate_config& config, const std::string& name)
+{
+  plan.leaves.back().child = plan.children.size();
+  plan.children.emplace_back(build_plan<typename LeafT::value_type>(config, name));
+}
+
+template <typename LeafT> void add_leaf(GeneratePlan& plan, const generate_config& config, const std::string& name)
+{
+  plan.leaves.push_back({config.lookup(name, default_distribution<LeafT>(config)), GeneratePlan::kNoChild});
+  add_child_plan<LeafT>(plan, config, name);
+}
+
+template <typename T, std::size_t... Is>
+void add_leaves(
+  GeneratePlan& plan,
+  const generate_config& config,
+  const std::vector<std::string>& names,
+  index_sequence<Is...> _)
+{
+  [[maybe_unused]] const auto __list =
+    std::initializer_list<int>{0, (add_leaf<std::tuple_element_t<Is, leaf_types_t<T>>>(plan, config, names[Is]), 0)...};
+}
+
+template <typename T> GeneratePlan build_plan(const generate_config& config, const std::string& prefix)
+{
+  std::vector<std::string> names = leaf_names<T>();
+  for (auto& name : names)
+  {
+    name = prefix.empty() ? name : name.empty() ? prefix : (prefix + "." + name);
+  }
+
+  GeneratePlan plan;
+  plan.leaves.reserve(leaf_count<T>);
+  add_leaves<T>(plan, config, names, make_index_sequence<leaf_count<T>>{});
+  return plan;
+}
+
+/**
+ * @brief Converts \c value to \c IntT, saturating at its limits (and mapping NaN to its lowest value)
+ *
+ * Compares against the limits as doubles, but only converts values strictly inside them; the maximum of a 64-bit
+ * integer rounds up to 2^63 or 2^64 as a double, which is not representable.
+ */
+template <typename IntT> IntT saturate(const double value)
+{
+  if (!(value > static_cast<double>(std::numeric_limits<IntT>::lowest())))
+  {
+    return std::numeric_limits<IntT>::lowest();
+  }
+  if (!(value < static_cast<double>(std::numeric_limits<IntT>::max())))
+  {
+    return std::numeric_limits<IntT>::max();
+  }
+  return static_cast<IntT>(value);
+}
+
+template <typename IntT, typename RngT> IntT sample_integral(RngT& rng, const field_distribution& d)
+{
+  using WideT = typename std::conditional<std::is_signed<IntT>::value, long long, unsigned long long>::type;
+  if (d.type == field_distribution::kind::normal)
+  {
+    std::normal_distribution<double> dist{d.a, d.b};
+    return saturate<IntT>(std::round(dist(rng)));
+  }
+  const WideT a = saturate<IntT>(std::ceil(d.a));
+  const WideT b = saturate<IntT>(std::floor(d.b));
+  std::uniform_int_distribution<WideT> dist{a, std::max(a, b)};
+  return static_cast<IntT>(dist(rng));
+}
+
+template <typename FloatT, typename RngT> FloatT sample_floating(RngT& rng, const field_distribution& d)
+{
+  if (d.type == field_distribution::kind::normal)
+  {
+    std::normal_distribution<FloatT> dist{static_cast<FloatT>(d.a), static_cast<FloatT>(d.b)};
+    return dist(rng);
+  }
+  if (!(d.a < d.b))
+  {
+    return static_cast<FloatT>(d.a);
+  }
+  std::uniform_real_distribution<FloatT> dist{static_cast<FloatT>(d.a), static_cast<FloatT>(d.b)};
+  return dist(rng);
+}
+
+template <typename T, typename RngT> void fill(T& value, const GeneratePlan& plan, RngT& rng);
+
+template <typename RngT> void fill_leaf(bool& value, const GeneratePlan& plan, const GeneratePlan::Leaf& leaf, RngT& rng)
+{
+  value = sample_integral<int>(rng, leaf.distribution) != 0;
+}
+
+template <typename T, typename RngT>
+std::enable_if_t<std::is_integral<T>::value> fill_leaf(T& value, const GeneratePlan& plan, const GeneratePlan::Leaf& leaf, RngT& rng)
+{
+  value = sample_integral<T>(rng, leaf.distribution);
+}
+
+template <typename T, typename RngT>
+std::enable_if_t<std::is_floating_point<T>::value>
+fill_leaf(T& value, const GeneratePlan& plan, const GeneratePlan::Leaf& leaf, RngT& rng)
+{
+  value = sample_floating<T>(rng, leaf.distribution);
+}
+
+template <typename T, typename RngT>
+std::enable_if_t<std::is_enum<T>::value> fill_leaf(T& value, const GeneratePlan& plan, const GeneratePlan::Leaf& leaf, RngT& rng)
+{
+  value = static_cast<T>(sample_integral<std::underlying_type_t<T>>(rng, leaf.distribution));
+}
+
+template <typename RngT>
+void fill_leaf(std::string& value, const GeneratePlan& plan, const GeneratePlan::Leaf& leaf, RngT& rng)
+{
+  static constexpr char kAlphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+  std::uniform_int_distribution<std::size_t> pick{0, sizeof(kAlphabet) - 2};
+  value.resize(sample_integral<std::size_t>(rng, leaf.distribution));
+  for (auto& c : value)
+  {
+    c = kAlphabet[pick(rng)];
+  }
+}
+
+template <typename T, typename AllocatorT, typename RngT>
+void fill_leaf(std::vector<T, AllocatorT>& value, const GeneratePlan& plan, const GeneratePlan::Leaf& leaf, RngT& rng)
+{
+  value.resize(sample_integral<std::size_t>(rng, leaf.distribution));
+  for (auto& element : value)
+  {
+    fill(element, plan.children[leaf.child], rng);
+  }
+}
+
+/// Unsupported leaf types are left as-is
+template <typename T, typename RngT>
+std::enable_if_t<!std::is_arithmetic<T>::value && !std::is_enum<T>::value>
+fill_leaf(T& value, const GeneratePlan& plan, const GeneratePlan::Leaf& leaf, RngT& rng)
+{}
+
+template <typename T, typename RngT> void fill(T& value, const GeneratePlan& plan, RngT& rng)
+{
+  ::about::detail::for_each_leaf_unrecorded(
+    [&plan, &rng](auto index, auto& leaf) {
+      fill_leaf(leaf, plan, plan.leaves[decltype(index)::value], rng);
+    },
+    value);
+}
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Generates random instances of \c T, with field distributions resolved once from a <code>generate_config</code>
+ *
+ * Every public member is filled, recursively: arithmetic and enum members (by underlying value; by default, between
+ * the smallest and largest enumerator), <code>bool</code>, <code>std::string</code> (alphanumeric) and
+ * <code>std::vector</code> (elements are generated recursively, with names prefixed by the vector member's name).
+ * Members of other types are left value-initialized.
+ *
+ * @tparam T  type to generate
+ */
+template <typename T> class generator
+{
+public:
+  explicit generator(const generate_config& config = generate_config{}) :
+      plan_{detail::build_plan<T>(config, std::string{})}
+  {}
+
+  /**
+   * @brief Overwrites every public member of \c value
+   */
+  template <typename RngT> void fill(T& value, RngT& rng) const { detail::fill(value, plan_, rng); }
+
+  /**
+   * @brief Returns a new random instance
+   */
+  template <typename RngT> T operator()(RngT& rng) const
+  {
+    T value{};
+    fill(value, rng);
+    return value;
+  }
+
+  /**
+   * @brief Returns \c count new random instances
+   */
+  template <typename RngT> std::vector<T> operator()(RngT& rng, const std::size_t count) const
+  {
+    std::vector<T> values(count);
+    for (auto& value : values)
+    {
+      fill(value, rng);
+    }
+    return values;
+  }
+
+private:
+  detail::GeneratePlan plan_;
+};
+
+/**
+ * @brief Returns a random instance of \c T
+ *
+ * @code{.cpp}
+ * std::mt19937_64 rng{seed};
+ * const auto obj = about::generate<my_ns::MyClass>(rng);
+ * @endcode
+ *
+ * @note prefer a <code>generator</code> when producing many values, so the configuration is resolved once
+ */
+template <typename T, typename RngT> T generate(RngT& rng, const generate_config& config = generate_config{})
+{
+  return generator<T>{config}(rng);
+}
+
+/**
+ * @brief Returns \c count random instances of \c T
+ */
+template <typename T, typename RngT>
+std::vector<T> generate(RngT& rng, const std::size_t count, const generate_config& config = generate_config{})
+{
+  return generator<T>{config}(rng, count);
+}
+
+/**
+ * @brief Random bit generator which replays bytes of a buffer
+ *
+ * Lets a fuzzer's input drive <code>generate</code>, so that fuzzer mutations map to structured changes of fields.
+ * Once the buffer is exhausted, values continue from a fixed pseudo-random sequence (standard distributions may
+ * reject a constant sequence forever).
+ */
+class fuzz_engine
+{
+public:
+  using result_type = std::uint32_t;
+
+  fuzz_engine(const std::uint8_t* data, const std::size_t size) : data_{data}, remaining_{size} {}
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  result_type operator()()
+  {
+    if (remaining_ == 0)
+    {
+      // splitmix64
+      std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ULL);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      return static_cast<result_type>(z ^ (z >> 31));
+    }
+
+    result_type value = 0;
+    for (std::size_t i = 0; i < sizeof(result_type) && remaining_ != 0; ++i, --remaining_)
+    {
+      value |= static_cast<result_type>(*data_++) << (8 * i);
+    }
+    return value;
+  }
+
+private:
+  const std::uint8_t* data_;
+  std::size_t remaining_;
+  std::uint64_t state_ = 0;
+};
+
+/**
+ * @brief Adapter for <code>LLVMFuzzerTestOneInput</code>: builds a \c T from fuzzer input, with generator \c g, and
+ *        passes it to \c test
+ *
+ * @code{.cpp}
+ * extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+ * {
+ *   static const about::generator<my_ns::MyClass> g{make_config()};
+ *   return about::fuzz_one_input(data, size, g, [](const my_ns::MyClass& obj) { round_trip(obj); });
+ * }
+ * @endcode
+ *
+ * @return \c 0, as expected by libFuzzer
+ */
+template <typename T, typename TestT>
+int fuzz_one_input(const std::uint8_t* data, const std::size_t size, const generator<T>& g, TestT&& test)
+{
+  fuzz_engine engine{data, size};
+  test(g(engine));
+  return 0;
+}
+
+/**
+ * @brief Adapter for <code>LLVMFuzzerTestOneInput</code>, using the default <code>generate_config</code>
+ *
+ * The default generator is built once, on first use
+ *
+ * @code{.cpp}
+ * extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+ * {
+ *   return about::fuzz_one_input<my_ns::MyClass>(data, size, [](const my_ns::MyClass& obj) { round_trip(obj); });
+ * }
+ * @endcode
+ *
+ * @return \c 0, as expected by libFuzzer
+ */
+template <typename T, typename TestT> int fuzz_one_input(const std::uint8_t* data, const std::size_t size, TestT&& test)
+{
+  static const generator<T> g{};
+  return fuzz_one_input(data, size, g, std::forward<TestT>(test));
+}
+
+}  // namespace about
+
+#endif  // ABOUT_GENERATE_HPP
@@ -0,0 +1,586 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_INDEXED_COLLECTION_HPP
+#define ABOUT_INDEXED_COLLECTION_HPP
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// About
+#include <about/about.hpp>
+#include <about/integer_sequence.hpp>
+#include <about/intern.hpp>
+#include <about/var.hpp>
+
+namespace about
+{
+
+/**
+ * @brief Index of an <code>indexed_collection</code> with unique keys, looked up by hash
+ *
+ * @tparam TagT  member tag, e.g. <code>decltype("id"_var)</code>
+ */
+template <typename TagT> struct hashed
+{
+  using tag_type = TagT;
+};
+
+/**
+ * @brief Index of an <code>indexed_collection</code> with sorted, possibly repeated, keys
+ *
+ * @tparam TagT  member tag, e.g. <code>decltype("ts"_var)</code>
+ */
+template <typename TagT> struct ordered
+{
+  using tag_type = TagT;
+};
+
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+using CollectionId = std::uint32_t;
+
+static constexpr CollectionId kNoCollectionId = std::numeric_limits<CollectionId>::max();
+
+template <typename T, typename TagT> const auto& index_key(const T& record)
+{
+  return ::about::detail::get_var_unrecorded(record, TagT{});
+}
+
+template <typename T, typename TagT> struct IndexKeyCheck
+{
+  static_assert(ClassMemberExists<T, TagT>::value, "indexed member does not exist");
+  using type = var_t<T, TagT>;
+};
+
+/**
+ * @brief Flat, open-addressing (linear probing) table of record ids, by unique key
+ *
+ * Each entry holds the low 32 bits of its key's hash, so that probing and growth do not read records. Erased entries
+ * are removed by shifting later entries back, so there are no tombstones.
+ */
+template <typename T, typename TagT> class HashedIndex
+{
+public:
+  using KeyT = typename IndexKeyCheck<T, TagT>::type;
+
+  CollectionId find(const std::vector<T>& records, const KeyT& key) const
+  {
+    if (table_.empty())
+    {
+      return kNoCollectionId;
+    }
+    const auto h = hash(key);
+    const std::size_t mask = table_.size() - 1;
+    for (std::size_t i = h & mask;; i = (i + 1) & mask)
+    {
+      const Entry& entry = table_[i];
+      if (entry.id == kNoCollectionId)
+      {
+        return kNoCollectionId;
+      }
+      if (entry.hash == h && index_key<T, TagT>(records[entry.id]) == key)
+      {
+        return entry.id;
+      }
+    }
+  }
+
+  /// Returns id of another record with the same key as \c record, or <code>kNoCollectionId</code>
+  CollectionId conflict(const std::vector<T>& records, const T& record, const CollectionId id) const
+  {
+    const CollectionId found = find(records, index_key<T, TagT>(record));
+    return (found == id) ? kNoCollectionId : found;
+  }
+
+  void insert(const std::vector<T>& records, const CollectionId id)
+  {
+    if ((size_ + 1) * 4 > table_.size() * 3)
+    {
+      grow();
+    }
+    place(Entry{hash(index_key<T, TagT>(records[id])), id});
+    ++size_;
+  }
+
+  void erase(const std::vector<T>& records, const CollectionId id)
+  {
+    const auto h = hash(index_key<T, TagT>(records[id]));
+    const std::size_t mask = table_.size() - 1;
+    std::size_t i = h & mask;
+    while (table_[i].id != id)
+    {
+      i = (i + 1) & mask;
+    }
+
+    // Shifts back later entries of the same probe run which may not be reached past the erased slot otherwise
+    for (std::size_t j = (i + 1) & mask; table_[j].id != kNoCollectionId; j = (j + 1) & mask)
+    {
+      const std::size_t home = table_[j].hash & mask;
+      const bool movable = (i <= j) ? (home <= i || home > j) : (home <= i && home > j);
+      if (movable)
+      {
+        table_[i] = table_[j];
+        i = j;
+      }
+    }
+    table_[i] = Entry{0, kNoCollectionId};
+    --size_;
+  }
+
+private:
+  struct Entry
+  {
+    std::uint32_t hash;
+    CollectionId id;
+  };
+
+  static std::uint32_t hash(const KeyT& key)
+  {
+    return static_cast<std::uint32_t>(hash_mix(static_cast<std::uint64_t>(std::hash<KeyT>{}(key))));
+  }
+
+  void place(const Entry entry)
+  {
+    const std::size_t mask = table_.size() - 1;
+    std::size_t i = entry.hash & mask;
+    while (table_[i].id != kNoCollectionId)
+    {
+      i = (i + 1) & mask;
+    }
+    table_[i] = entry;
+  }
+
+  void grow()
+  {
+    std::vector<Entry> previous(std::max<std::size_t>(16, table_.size() * 2), Entry{0, kNoCollectionId});
+    previous.swap(table_);
+    for (const auto& entry : previous)
+    {
+      if (entry.id != kNoCollectionId)
+      {
+        place(entry);
+      }
+    }
+  }
+
+  std::vector<Entry> table_;
+  std::size_t size_ = 0;
+};
+
+/**
+ * @brief Record ids sorted by key (then id), in a sequence of bounded sorted blocks
+ *
+ * Equivalent to a B+tree with two levels: blocks are found by binary search over their last entries, then searched
+ * themselves. Inserts and erases move at most one block's worth of entries.
+ */
+template <typename T, typename TagT> class OrderedIndex
+{
+public:
+  using KeyT = typename IndexKeyCheck<T, TagT>::type;
+
+  CollectionId conflict(const std::vector<T>& records, const T& record, const CollectionId id) const
+  {
+    return kNoCollectionId;
+  }
+
+  void insert(const std::vector<T>& records, const CollectionId id)
+  {
+    const Entry entry{index_key<T, TagT>(records[id]), id};
+    if (blocks_.empty())
+    {
+      blocks_.emplace_back();
+      blocks_.back().reserve(kMaxBlockSize);
+      blocks_.back().push_back(entry);
+      return;
+    }
+    const auto block = std::min(find_block(entry), blocks_.end() - 1);
+    block->insert(std::lower_bound(block->begin(), block->end(), entry, less), entry);
+    if (block->size() > kMaxBlockSize)
+    {
+      const auto middle = block->begin() + static_cast<std::ptrdiff_t>(block->size() / 2);
+      std::vector<Entry> upper(middle, block->end());
+      block->erase(middle, block->end());
+      upper.reserve(kMaxBlockSize);
+      blocks_.insert(block + 1, std::move(upper));
+    }
+  }
+
+  void erase(const std::vector<T>& records, const CollectionId id)
+  {
+    const Entry entry{index_key<T, TagT>(records[id]), id};
+    const auto block = find_block(entry);
+    block->erase(std::lower_bound(block->begin(), block->end(), entry, less));
+    if (block->empty())
+    {
+      blocks_.erase(block);
+    }
+  }
+
+  /// Invokes <code>cb(id)</code> for each record with key in <code>[first, last)</code>, in key order
+  template <typename CallbackT> void for_each_in(const KeyT& first, const KeyT& last, CallbackT&& cb) const
+  {
+    auto block = std::partition_point(
+      blocks_.begin(), blocks_.end(), [&first](const std::vector<Entry>& b) { return b.back().key < first; });
+    for (bool first_block = true; block != blocks_.end(); ++block, first_block = false)
+    {
+      auto itr = first_block
+        ? std::partition_point(block->begin(), block->end(), [&first](const Entry& e) { return e.key < first; })
+        : block->begin();
+      for (; itr != block->end(); ++itr)
+      {
+        if (!(itr->key < last))
+        {
+          return;
+        }
+        cb(itr->id);
+      }
+    }
+  }
+
+  /// Invokes <code>cb(id)</code> for each record, in key order
+  template <typename CallbackT> void for_each(CallbackT&& cb) const
+  {
+    for (const auto& block : blocks_)
+    {
+      for (const auto& entry : block)
+      {
+        cb(entry.id);
+      }
+    }
+  }
+
+private:
+  static constexpr std::size_t kMaxBlockSize = 256;
+
+  struct Entry
+  {
+    KeyT key;
+    CollectionId id;
+  };
+
+  static bool less(const Entry& lhs, const Entry& rhs)
+  {
+    return (lhs.key < rhs.key) || (!(rhs.key < lhs.key) && lhs.id < rhs.id);
+  }
+
+  /// First block whose last entry is not less than \c entry, or the end
+  typename std::vector<std::vector<Entry>>::iterator find_block(const Entry& entry)
+  {
+    return std::partition_point(
+      blocks_.begin(), blocks_.end(), [&entry](const std::vector<Entry>& b) { return less(b.back(), entry); });
+  }
+
+  std::vector<std::vector<Entry>> blocks_;
+};
+
+template <typename T, typename IndexT> struct IndexImpl;
+
+template <typename T, typename TagT> struct IndexImpl<T, hashed<TagT>>
+{
+  using type = HashedIndex<T, TagT>;
+};
+
+template <typename T, typename TagT> struct IndexImpl<T, ordered<TagT>>
+{
+  using type = OrderedIndex<T, TagT>;
+};
+
+constexpr std::size_t find_true(std::initializer_list<bool> matches)
+{
+  std::size_t i = 0;
+  for (const bool match : matches)
+  {
+    if (match)
+    {
+      return i;
+    }
+    ++i;
+  }
+  return i;
+}
+
+/// Position of the index over member \c TagT within \c IndexTs
+template <typename TagT, typename... IndexTs> struct IndexPosition
+{
+  static constexpr std::size_t value = find_true({std::is_same<TagT, typename IndexTs::tag_type>::value...});
+  static_assert(value < sizeof...(IndexTs), "collection has no index over this member");
+};
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Stores records of \c T once, and keeps one or more indexes over their members up to date
+ *
+ * Replaces several maps over the same records which must be kept consistent by hand. Records live in one contiguous
+ * slab, and are identified by stable ids; slots of erased records are reused.
+ *
+ * @code{.cpp}
+ * about::indexed_collection<Order, about::hashed<decltype("id"_var)>, about::ordered<decltype("ts"_var)>> orders;
+ * orders.insert(order);
+ * const Order* found = orders.find("id"_var, 42);
+ * orders.for_each_in("ts"_var, t0, t1, [](auto id, const Order& order) { ... });
+ * @endcode
+ *
+ * Keys of <code>hashed</code> indexes are unique: an insert which would repeat one is rejected. Members indexed by
+ * <code>hashed</code> need <code>std::hash</code> and <code>operator==</code>; members indexed by <code>ordered</code>
+ * need <code>operator<</code>. Members are checked to exist at compile time.
+ *
+ * @tparam T  reflected class type
+ * @tparam IndexTs  <code>hashed</code> or <code>ordered</code>, each naming a member
+ */
+template <typename T, typename... IndexTs> class indexed_collection
+{
+  static_assert(is_reflected_class<T>, "indexed_collection requires a reflected class type");
+  static_assert(sizeof...(IndexTs) > 0, "indexed_collection requires at least one index");
+
+public:
+  /// Stable identifier of a stored record
+  using id_type = detail::CollectionId;
+
+  /// Id which identifies no record
+  static constexpr id_type npos = detail::kNoCollectionId;
+
+  /**
+   * @brief Stores \c record, and adds it to all indexes
+   *
+   * @return id of stored record and \c true; or, if a <code>hashed</code> key is taken, id of the record which holds
+   *         it and \c false
+   *
+   * @throws std::length_error  if the collection is full
+   */
+  std::pair<id_type, bool> insert(T record)
+  {
+    const id_type taken = conflict(record, npos);
+    if (taken != npos)
+    {
+      return std::make_pair(taken, false);
+    }
+
+    id_type id;
+    if (free_.empty())
+    {
+      if (records_.size() >= npos)
+      {
+        throw std::length_error{"indexed_collection: too many records"};
+      }
+      id = static_cast<id_type>(records_.size());
+      records_.emplace_back(std::move(record));
+      live_.push_back(true);
+    }
+    else
+    {
+      id = free_.back();
+      free_.pop_back();
+      records_[id] = std::move(record);
+      live_[id] = true;
+    }
+    index_insert(id);
+    ++size_;
+    return std::make_pair(id, true);
+  }
+
+  /**
+   * @brief Removes record \c id from the collection and all indexes
+   *
+   * @return \c true if \c id was a stored record
+   */
+  bool erase(const id_type id)
+  {
+    if (!contains(id))
+    {
+      return false;
+    }
+    index_erase(id);
+    records_[id] = T{};
+    live_[id] = false;
+    free_.push_back(id);
+    --size_;
+    return true;
+  }
+
+  /**
+   * @brief Applies <code>fn(T&)</code> to a copy of record \c id, and replaces it, re-indexing its keys
+   *
+   * @return \c false, leaving the record unchanged, if \c id is not stored or a modified <code>hashed</code> key is
+   *         taken by another record
+   */
+  template <typename FnT> bool modify(const id_type id, FnT&& fn)
+  {
+    if (!contains(id))
+    {
+      return false;
+    }
+    T record = records_[id];
+    fn(record);
+    if (conflict(record, id) != npos)
+    {
+      return false;
+    }
+    index_erase(id);
+    records_[id] = std::move(record);
+    index_insert(id);
+    return true;
+  }
+
+  /**
+   * @brief Returns id of record whose member named by \c tag equals \c key, or <code>npos</code>
+   *
+   * Member must have a <code>hashed</code> index.
+   */
+  template <char... Chars>
+  id_type find_id(detail::VarName<Chars...> tag, const var_t<T, detail::VarName<Chars...>>& key) const
+  {
+    return index(tag).find(records_, key);
+  }
+
+  /**
+   * @brief Returns record whose member named by \c tag equals \c key, or \c nullptr
+   *
+   * Member must have a <code>hashed</code> index. The pointer is invalidated by the next insert.
+   */
+  template <char... Chars>
+  const T* find(detail::VarName<Chars...> tag, const var_t<T, detail::VarName<Chars...>>& key) const
+  {
+    const id_type id = find_id(tag, key);
+    return (id == npos) ? nullptr : std::addressof(records_[id]);
+  }
+
+  /**
+   * @brief Invokes <code>cb(id, record)</code> for each record whose member named by \c tag is in
+   *        <code>[first, last)</code>, in order of that member
+   *
+   * Member must have an <code>ordered</code> index. The collection must not be modified by \c cb.
+   */
+  template <char... Chars, typename CallbackT>
+  void for_each_in(
+    detail::VarName<Chars...> tag,
+    const var_t<T, detail::VarName<Chars...>>& first,
+    const var_t<T, detail::VarName<Chars...>>& last,
+    CallbackT&& cb) const
+  {
+    index(tag).for_each_in(first, last, [this, &cb](const id_type id) { cb(id, records_[id]); });
+  }
+
+  /**
+   * @brief Invokes <code>cb(id, record)</code> for each record, in order of the member named by \c tag
+   *
+   * Member must have an <code>ordered</code> index.
+   */
+  template <char... Chars, typename CallbackT> void for_each_ordered(detail::VarName<Chars...> tag, CallbackT&& cb) const
+  {
+    index(tag).for_each([this, &cb](const id_type id) { cb(id, records_[id]); });
+  }
+
+  /**
+   * @brief Invokes <code>cb(id, record)</code> for each record, in order of storage
+   */
+  template <typename CallbackT> void for_each(CallbackT&& cb) const
+  {
+    for (std::size_t id = 0; id < records_.size(); ++id)
+    {
+      if (live_[id])
+      {
+        cb(static_cast<id_type>(id), records_[id]);
+      }
+    }
+  }
+
+  /**
+   * @brief Returns \c true if \c id is a stored record
+   */
+  bool contains(const id_type id) const { return id < records_.size() && live_[id]; }
+
+  /**
+   * @brief Returns stored record \c id
+   *
+   * @throws std::out_of_range  if \c id is not a stored record
+   */
+  const T& at(const id_type id) const
+  {
+    if (!contains(id))
+    {
+      throw std::out_of_range{"indexed_collection: no record with this id"};
+    }
+    return records_[id];
+  }
+
+  /**
+   * @brief Returns stored record \c id, which must be stored
+   */
+  const T& operator[](const id_type id) const { return records_[id]; }
+
+  /**
+   * @brief Returns number of stored records
+   */
+  std::size_t size() const { return size_; }
+
+  /**
+   * @brief Returns \c true if no records are stored
+   */
+  bool empty() const { return size_ == 0; }
+
+private:
+  using Indexes = std::tuple<typename detail::IndexImpl<T, IndexTs>::type...>;
+
+  template <typename TagT> const auto& index(TagT _) const
+  {
+    return std::get<detail::IndexPosition<TagT, IndexTs...>::value>(indexes_);
+  }
+
+  template <std::size_t... Is> id_type conflict(const T& record, const id_type id, index_sequence<Is...> _) const
+  {
+    id_type taken = npos;
+    [[maybe_unused]] const auto __list = std::initializer_list<int>{
+      0, (taken = (taken != npos) ? taken : std::get<Is>(indexes_).conflict(records_, record, id), 0)...};
+    return taken;
+  }
+
+  id_type conflict(const T& record, const id_type id) const
+  {
+    return conflict(record, id, make_index_sequence<sizeof...(IndexTs)>{});
+  }
+
+  template <std::size_t... Is> void index_insert(const id_type id, index_sequence<Is...> _)
+  {
+    [[maybe_unused]] const auto __list =
+      std::initializer_list<int>{0, (std::get<Is>(indexes_).insert(records_, id), 0)...};
+  }
+
+  void index_insert(const id_type id) { index_insert(id, make_index_sequence<sizeof...(IndexTs)>{}); }
+
+  template <std::size_t... Is> void index_erase(const id_type id, index_sequence<Is...> _)
+  {
+    [[maybe_unused]] const auto __list =
+      std::initializer_list<int>{0, (std::get<Is>(indexes_).erase(records_, id), 0)...};
+  }
+
+  void index_erase(const id_type id) { index_erase(id, make_index_sequence<sizeof...(IndexTs)>{}); }
+
+  std::vector<T> records_;
+  std::vector<bool> live_;
+  std::vector<id_type> free_;
+  std::size_t size_ = 0;
+  Indexes indexes_;
+};
+
+template <typename T, typename... IndexTs>
+constexpr typename indexed_collection<T, IndexTs...>::id_type indexed_collection<T, IndexTs...>::npos;
+
+}  // namespace about
+
+#endif  // ABOUT_INDEXED_COLLECTION_HPP
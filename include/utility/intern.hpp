@@ -0,0 +1,425 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_INTERN_HPP
+#define ABOUT_INTERN_HPP
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// About
+#include <about/about.hpp>
+#include <about/flatten.hpp>
+#include <about/integer_sequence.hpp>
+
+namespace about
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+inline std::uint64_t hash_mix(std::uint64_t h)
+{
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDULL;
+  h ^= h >> 33;
+  h *= 0xC4CEB9FE1A85EC53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+inline std::uint64_t hash_combine(const std::uint64_t seed, const std::uint64_t value)
+{
+  return hash_mix(seed ^ (value + 0x9E3779B97F4A7C15ULL + (seed << 6) + (seed >> 2)));
+}
+
+/// Hashes and compares a leaf with <code>std::hash</code> and <code>operator==</code>
+template <typename T, typename Enable = void> struct LeafIdentity
+{
+  static std::uint64_t hash(const T& value) { return static_cast<std::uint64_t>(std::hash<T>{}(value)); }
+  static bool equal(const T& lhs, const T& rhs) { return lhs == rhs; }
+};
+
+/**
+ * @brief Hashes and compares a <code>float</code> or <code>double</code> leaf by its bit pattern
+ *
+ * -0 is folded into +0, so that values which compare equal are still the same value, and a NaN is the same value as
+ * itself (it never compares equal with <code>operator==</code>)
+ */
+template <typename T>
+struct LeafIdentity<T, std::enable_if_t<std::is_same<T, float>::value || std::is_same<T, double>::value>>
+{
+  using bits_type = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+  static_assert(sizeof(bits_type) == sizeof(T), "unsupported floating point representation");
+
+  static bits_type bits(const T value)
+  {
+    bits_type b = 0;
+    if (value != T{0})
+    {
+      std::memcpy(&b, &value, sizeof(b));
+    }
+    return b;
+  }
+
+  static std::uint64_t hash(const T value) { return hash_mix(bits(value)); }
+  static bool equal(const T lhs, const T rhs) { return bits(lhs) == bits(rhs); }
+};
+
+/// Padding bits of a <code>long double</code> are unspecified, so all of its NaNs are treated as the same value
+template <> struct LeafIdentity<long double>
+{
+  static std::uint64_t hash(const long double value)
+  {
+    return std::isnan(value) ? 0 : static_cast<std::uint64_t>(std::hash<long double>{}(value));
+  }
+  static bool equal(const long double lhs, const long double rhs)
+  {
+    return (lhs == rhs) || (std::isnan(lhs) && std::isnan(rhs));
+  }
+};
+
+template <typename T, std::size_t... Is> bool equal_leaves(const T& lhs, const T& rhs, index_sequence<Is...> _)
+{
+  bool equal = true;
+  [[maybe_unused]] const auto __list = std::initializer_list<int>{
+    0,
+    (equal = equal && LeafIdentity<std::tuple_element_t<Is, leaf_types_t<T>>>::equal(
+                        ::about::detail::get_leaf_unrecorded<Is>(lhs), ::about::detail::get_leaf_unrecorded<Is>(rhs)),
+     0)...};
+  return equal;
+}
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Hashes all leaf members of \c value, recursively, with <code>std::hash</code>
+ *
+ * <code>float</code> and <code>double</code> leaves are hashed by bit pattern, with -0 folded into +0.
+ */
+template <typename T> std::uint64_t hash_members(const T& value)
+{
+  std::uint64_t h = 0;
+  ::about::detail::for_each_leaf_unrecorded(
+    [&h](auto index, const auto& leaf) {
+      using LeafT = std::decay_t<decltype(leaf)>;
+      h = detail::hash_combine(h, detail::LeafIdentity<LeafT>::hash(leaf));
+    },
+    value);
+  return h;
+}
+
+/**
+ * @brief Compares all leaf members of \c lhs and \c rhs, recursively, with <code>operator==</code>
+ *
+ * <code>float</code> and <code>double</code> leaves are compared by bit pattern, with -0 folded into +0, so a value
+ * holding a NaN is equal to itself, and is only interned once; <code>long double</code> NaNs are all equal.
+ */
+template <typename T> bool equal_members(const T& lhs, const T& rhs)
+{
+  return detail::equal_leaves(lhs, rhs, make_index_sequence<leaf_count<T>>{});
+}
+
+/**
+ * @brief Memory accounting of an <code>intern_pool</code>
+ */
+struct intern_pool_stats
+{
+  /// Number of calls to <code>intern</code>
+  std::size_t interned;
+
+  /// Number of distinct values stored
+  std::size_t distinct;
+
+  /// Bytes used by stored values and hash tables
+  std::size_t pool_bytes;
+
+  /// Bytes which every interned value would have used as a separate copy
+  std::size_t copied_bytes;
+
+  /**
+   * @brief Returns bytes saved by holding one handle per interned value, rather than one copy
+   *
+   * Only counts <code>sizeof(T)</code> per value; memory owned by members (e.g. heap buffers) is not counted.
+   */
+  std::ptrdiff_t saved_bytes(const std::size_t handle_size = sizeof(std::uint32_t)) const
+  {
+    return static_cast<std::ptrdiff_t>(copied_bytes) -
+      static_cast<std::ptrdiff_t>(pool_bytes + interned * handle_size);
+  }
+};
+
+/**
+ * @brief Stores each distinct value of \c T once, and identifies it by a compact handle
+ *
+ * Values are hashed and compared member-wise (see <code>hash_members</code> and <code>equal_members</code>), so
+ * reflected types need no hand-written hash or equality. The pool is split into <code>2^ShardBits</code> shards, by
+ * hash; each has its own lock, flat open-addressing (linear probing) table of 32-bit handles, and storage.
+ *
+ * Values never move once stored, so references returned by <code>get</code> remain valid for the life of the pool.
+ *
+ * @code{.cpp}
+ * about::intern_pool<Pose> pool;
+ * const auto h = pool.intern(pose);  // safe to call from many threads
+ * const Pose& shared = pool.get(h);
+ * @endcode
+ *
+ * @tparam T  reflected class type
+ * @tparam ShardBits  log2 of number of shards
+ */
+template <typename T, std::size_t ShardBits = 4> class intern_pool
+{
+  static_assert(is_reflected_class<T>, "intern_pool requires a reflected class type");
+  static_assert(ShardBits < 16, "too many intern_pool shards");
+
+public:
+  /**
+   * @brief Identifies a value stored in an <code>intern_pool</code>
+   *
+   * Equal handles (from the same pool) refer to equal values, and vice versa.
+   */
+  class handle
+  {
+  public:
+    handle() = default;
+
+    std::uint32_t value() const { return value_; }
+
+    bool operator==(const handle& other) const { return value_ == other.value_; }
+    bool operator!=(const handle& other) const { return value_ != other.value_; }
+
+  private:
+    friend class intern_pool;
+
+    explicit handle(const std::uint32_t value) : value_{value} {}
+
+    std::uint32_t value_ = 0;
+  };
+
+  intern_pool() = default;
+
+  intern_pool(const intern_pool&) = delete;
+  intern_pool& operator=(const intern_pool&) = delete;
+
+  /**
+   * @brief Returns handle to the stored value equal to \c value, storing a copy first if there is none
+   *
+   * @throws std::length_error  if a shard is full
+   */
+  handle intern(const T& value)
+  {
+    const std::uint64_t h = hash_members(value);
+    const std::size_t s = static_cast<std::size_t>(h >> (64 - kShardBitsNonZero)) & kShardMask;
+    const std::uint32_t local = shards_[s].intern(value, h);
+    interned_.fetch_add(1, std::memory_order_relaxed);
+    return handle{(local << ShardBits) | static_cast<std::uint32_t>(s)};
+  }
+
+  /**
+   * @brief Returns stored value identified by \c h
+   */
+  const T& get(const handle h) const { return shards_[h.value_ & kShardMask].get(h.value_ >> ShardBits); }
+
+  /**
+   * @copydoc get
+   */
+  const T& operator[](const handle h) const { return get(h); }
+
+  /**
+   * @brief Returns number of distinct values stored
+   */
+  std::size_t size() const
+  {
+    std::size_t n = 0;
+    for (const auto& shard : shards_)
+    {
+      n += shard.size();
+    }
+    return n;
+  }
+
+  /**
+   * @brief Returns memory accounting of values interned so far
+   */
+  intern_pool_stats stats() const
+  {
+    intern_pool_stats result{interned_.load(std::memory_order_relaxed), 0, 0, 0};
+    for (const auto& shard : shards_)
+    {
+      const auto shard_stats = shard.stats();
+      result.distinct += shard_stats.first;
+      result.pool_bytes += shard_stats.second;
+    }
+    result.copied_bytes = result.interned * sizeof(T);
+    return result;
+  }
+
+private:
+  static constexpr std::size_t kShardCount = std::size_t{1} << ShardBits;
+  static constexpr std::size_t kShardMask = kShardCount - 1;
+  static constexpr std::size_t kShardBitsNonZero = (ShardBits == 0) ? 1 : ShardBits;
+
+  /// Largest number of values per shard, such that handles fit in 32 bits
+  static constexpr std::size_t kMaxLocal = std::size_t{1} << (32 - ShardBits);
+
+  /// Values are stored in blocks of doubling size, starting with <code>2^kFirstBlockBits</code>
+  static constexpr std::size_t kFirstBlockBits = 8;
+  static constexpr std::size_t kBlockCount = 32 - kFirstBlockBits + 1;
+
+  static std::size_t floor_log2(std::size_t n)
+  {
+    std::size_t log2 = 0;
+    while (n >>= 1)
+    {
+      ++log2;
+    }
+    return log2;
+  }
+
+  class Shard
+  {
+  public:
+    Shard() = default;
+
+    ~Shard()
+    {
+      for (std::size_t i = 0; i < size_; ++i)
+      {
+        slot_address(i)->~T();
+      }
+      for (std::size_t b = 0; b < kBlockCount && blocks_[b] != nullptr; ++b)
+      {
+        ::operator delete(blocks_[b]);
+      }
+    }
+
+    std::uint32_t intern(const T& value, const std::uint64_t h)
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      if ((size_ + 1) * 4 > table_.size() * 3)
+      {
+        grow();
+      }
+
+      const auto tag = static_cast<std::uint32_t>(h);
+      const std::size_t mask = table_.size() - 1;
+      for (std::size_t i = static_cast<std::size_t>(h) & mask;; i = (i + 1) & mask)
+      {
+        Entry& entry = table_[i];
+        if (entry.local_plus_one == 0)
+        {
+          const std::uint32_t local = emplace(value);
+          entry = Entry{tag, local + 1};
+          return local;
+        }
+        if (entry.tag == tag && equal_members(*slot_address(entry.local_plus_one - 1), value))
+        {
+          return entry.local_plus_one - 1;
+        }
+      }
+    }
+
+    const T& get(const std::size_t local) const { return *slot_address(local); }
+
+    std::size_t size() const
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      return size_;
+    }
+
+    /// Number of values, and bytes used
+    std::pair<std::size_t, std::size_t> stats() const
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      std::size_t bytes = table_.capacity() * sizeof(Entry);
+      for (std::size_t b = 0; b < kBlockCount && blocks_[b] != nullptr; ++b)
+      {
+        bytes += block_capacity(b) * sizeof(T);
+      }
+      return std::make_pair(size_, bytes);
+    }
+
+  private:
+    struct Entry
+    {
+      /// Low bits of hash, compared before values
+      std::uint32_t tag;
+
+      /// Local index of value, plus one; zero if empty
+      std::uint32_t local_plus_one;
+    };
+
+    static std::size_t block_capacity(const std::size_t b) { return std::size_t{1} << (kFirstBlockBits + b); }
+
+    T* slot_address(const std::size_t local) const
+    {
+      const std::size_t j = local + (std::size_t{1} << kFirstBlockBits);
+      const std::size_t msb = floor_log2(j);
+      return blocks_[msb - kFirstBlockBits] + (j - (std::size_t{1} << msb));
+    }
+
+    std::uint32_t emplace(const T& value)
+    {
+      if (size_ + 1 >= kMaxLocal)
+      {
+        throw std::length_error{"intern_pool: shard is full"};
+      }
+      const std::size_t b = floor_log2(size_ + (std::size_t{1} << kFirstBlockBits)) - kFirstBlockBits;
+      if (blocks_[b] == nullptr)
+      {
+        blocks_[b] = static_cast<T*>(::operator new(block_capacity(b) * sizeof(T)));
+      }
+      new (slot_address(size_)) T(value);
+      return static_cast<std::uint32_t>(size_++);
+    }
+
+    void grow()
+    {
+      std::vector<Entry> table(std::max<std::size_t>(16, table_.size() * 2), Entry{0, 0});
+      const std::size_t mask = table.size() - 1;
+      for (const auto& entry : table_)
+      {
+        if (entry.local_plus_one == 0)
+        {
+          continue;
+        }
+        const std::uint64_t h = hash_members(*slot_address(entry.local_plus_one - 1));
+        std::size_t i = static_cast<std::size_t>(h) & mask;
+        while (table[i].local_plus_one != 0)
+        {
+          i = (i + 1) & mask;
+        }
+        table[i] = entry;
+      }
+      table_.swap(table);
+    }
+
+    mutable std::mutex mutex_;
+    std::vector<Entry> table_;
+    std::size_t size_ = 0;
+    T* blocks_[kBlockCount] = {};
+  };
+
+  std::atomic<std::size_t> interned_{0};
+  Shard shards_[kShardCount];
+};
+
+}  // namespace about
+
+#endif  // ABOUT_INTERN_HPP
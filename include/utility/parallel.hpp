@@ -0,0 +1,47 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_PARALLEL_HPP
+#define ABOUT_PARALLEL_HPP
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace about
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/// Runs <code>fn(t)</code> for each <code>t</code> in <code>[0, thread_count)</code>, using the calling thread for \c 0
+template <typename FnT> void run_parallel(const std::size_t thread_count, FnT&& fn)
+{
+  std::vector<std::thread> workers;
+  workers.reserve(thread_count - 1);
+  for (std::size_t t = 1; t < thread_count; ++t)
+  {
+    workers.emplace_back([&fn, t] { fn(t); });
+  }
+  fn(0);
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+}
+
+/// Number of threads used for \c n items, such that each thread handles at least \c min_per_thread items
+inline std::size_t parallel_thread_count(const std::size_t n, const std::size_t min_per_thread)
+{
+  const std::size_t hardware_threads = std::max(1U, std::thread::hardware_concurrency());
+  return std::max<std::size_t>(1UL, std::min<std::size_t>(hardware_threads, n / min_per_thread));
+}
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+}  // namespace about
+
+#endif  // ABOUT_PARALLEL_HPP
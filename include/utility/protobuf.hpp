@@ -0,0 +1,605 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_PROTOBUF_HPP
+#define ABOUT_PROTOBUF_HPP
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// About
+#include <about/about.hpp>
+#include <about/flatten.hpp>
+#include <about/integer_sequence.hpp>
+#include <about/var.hpp>
+
+namespace about
+{
+namespace protobuf
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+enum class WireType : std::uint32_t
+{
+  varint = 0,
+  fixed64 = 1,
+  length_delimited = 2,
+  fixed32 = 5
+};
+
+template <typename... Ts> struct MakeVoid
+{
+  using type = void;
+};
+
+/// Field number of the \c I th member: <code>InfoT::field_number</code> if generated, otherwise <code>I + 1</code>
+template <typename InfoT, std::size_t I, typename Enable = void> struct FieldNumber
+{
+  static constexpr std::uint32_t value = static_cast<std::uint32_t>(I + 1);
+};
+
+template <typename InfoT, std::size_t I>
+struct FieldNumber<InfoT, I, typename MakeVoid<decltype(InfoT::field_number)>::type>
+{
+  static constexpr std::uint32_t value = static_cast<std::uint32_t>(InfoT::field_number);
+};
+
+template <typename T, std::size_t I>
+using MemberFieldNumber = FieldNumber<std::tuple_element_t<I, public_var_info_t<T>>, I>;
+
+constexpr std::size_t varint_size(std::uint64_t value)
+{
+  std::size_t size = 1;
+  while (value >= 0x80)
+  {
+    value >>= 7;
+    ++size;
+  }
+  return size;
+}
+
+inline char* write_varint(char* out, std::uint64_t value)
+{
+  while (value >= 0x80)
+  {
+    *out++ = static_cast<char>(static_cast<std::uint8_t>(value) | 0x80);
+    value >>= 7;
+  }
+  *out++ = static_cast<char>(value);
+  return out;
+}
+
+template <typename UIntT> inline char* write_fixed(char* out, const UIntT value)
+{
+  for (std::size_t i = 0; i < sizeof(UIntT); ++i)
+  {
+    *out++ = static_cast<char>(static_cast<std::uint8_t>(value >> (8 * i)));
+  }
+  return out;
+}
+
+/**
+ * @brief Bounds-checked cursor over encoded bytes
+ */
+class Reader
+{
+public:
+  Reader(const char* first, const char* last) : pos_{first}, last_{last} {}
+
+  bool done() const { return pos_ == last_; }
+
+  const char* data() const { return pos_; }
+
+  std::size_t size() const { return static_cast<std::size_t>(last_ - pos_); }
+
+  std::uint64_t read_varint()
+  {
+    std::uint64_t value = 0;
+    for (std::size_t shift = 0; shift < 64; shift += 7)
+    {
+      if (pos_ == last_)
+      {
+        throw std::runtime_error{"protobuf: truncated varint"};
+      }
+      const auto byte = static_cast<std::uint8_t>(*pos_++);
+      value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0)
+      {
+        return value;
+      }
+    }
+    throw std::runtime_error{"protobuf: malformed varint"};
+  }
+
+  template <typename UIntT> UIntT read_fixed()
+  {
+    const char* first = take(sizeof(UIntT));
+    UIntT value = 0;
+    for (std::size_t i = 0; i < sizeof(UIntT); ++i)
+    {
+      value |= static_cast<UIntT>(static_cast<std::uint8_t>(first[i])) << (8 * i);
+    }
+    return value;
+  }
+
+  /// Returns reader over the next length-delimited payload, and moves past it
+  Reader read_length_delimited()
+  {
+    const std::uint64_t length = read_varint();
+    if (length > size())
+    {
+      throw std::runtime_error{"protobuf: truncated length-delimited field"};
+    }
+    const char* first = take(static_cast<std::size_t>(length));
+    return Reader{first, first + length};
+  }
+
+  void skip(const WireType wire)
+  {
+    switch (wire)
+    {
+    case WireType::varint:
+      read_varint();
+      return;
+    case WireType::fixed64:
+      take(8);
+      return;
+    case WireType::length_delimited:
+      read_length_delimited();
+      return;
+    case WireType::fixed32:
+      take(4);
+      return;
+    }
+    throw std::runtime_error{"protobuf: unsupported wire type"};
+  }
+
+private:
+  const char* take(const std::size_t n)
+  {
+    if (n > size())
+    {
+      throw std::runtime_error{"protobuf: truncated field"};
+    }
+    const char* first = pos_;
+    pos_ += n;
+    return first;
+  }
+
+  const char* pos_;
+  const char* last_;
+};
+
+template <typename T> std::size_t message_size(const T& value);
+template <typename T> char* write_message(char* out, const T& value);
+template <typename T> void read_message(Reader reader, T& value);
+
+template <typename T> struct AlwaysFalse : std::false_type
+{};
+
+/**
+ * @brief Encoding of a single value of type \c T, without its tag
+ */
+template <typename T, typename Enable = void> struct Codec
+{
+  static_assert(AlwaysFalse<T>::value, "type has no protobuf wire encoding");
+};
+
+/// <code>int32</code>, <code>int64</code>, <code>uint32</code>, <code>uint64</code> and <code>enum</code>
+template <typename T>
+struct Codec<T, std::enable_if_t<(std::is_integral<T>::value && !std::is_same<T, bool>::value) || std::is_enum<T>::value>>
+{
+  using IntT = typename std::conditional_t<std::is_enum<T>::value, std::underlying_type<T>, std::common_type<T>>::type;
+  using WideT = std::conditional_t<std::is_signed<IntT>::value, std::int64_t, std::uint64_t>;
+
+  static constexpr WireType wire = WireType::varint;
+
+  static std::uint64_t bits(const T value) { return static_cast<std::uint64_t>(static_cast<WideT>(value)); }
+
+  static bool is_default(const T value) { return value == T{}; }
+
+  static std::size_t size(const T value) { return varint_size(bits(value)); }
+
+  static char* write(char* out, const T value) { return write_varint(out, bits(value)); }
+
+  static void read(Reader& reader, T& value) { value = static_cast<T>(static_cast<IntT>(reader.read_varint())); }
+};
+
+template <> struct Codec<bool>
+{
+  static constexpr WireType wire = WireType::varint;
+
+  static bool is_default(const bool value) { return !value; }
+
+  static std::size_t size(const bool value) { return 1; }
+
+  static char* write(char* out, const bool value)
+  {
+    *out++ = value ? 1 : 0;
+    return out;
+  }
+
+  static void read(Reader& reader, bool& value) { value = reader.read_varint() != 0; }
+};
+
+/// <code>float</code> as <code>fixed32</code>, and <code>double</code> as <code>fixed64</code>
+template <typename T> struct Codec<T, std::enable_if_t<std::is_floating_point<T>::value>>
+{
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8, "floating point type has no protobuf wire encoding");
+
+  using BitsT = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+  static constexpr WireType wire = (sizeof(T) == 4) ? WireType::fixed32 : WireType::fixed64;
+
+  static BitsT bits(const T value)
+  {
+    BitsT b;
+    std::memcpy(&b, &value, sizeof(b));
+    return b;
+  }
+
+  static bool is_default(const T value) { return bits(value) == 0; }
+
+  static std::size_t size(const T value) { return sizeof(T); }
+
+  static char* write(char* out, const T value) { return write_fixed(out, bits(value)); }
+
+  static void read(Reader& reader, T& value)
+  {
+    const auto b = reader.template read_fixed<BitsT>();
+    std::memcpy(&value, &b, sizeof(value));
+  }
+};
+
+template <typename CharT, typename TraitsT, typename AllocatorT>
+struct Codec<std::basic_string<CharT, TraitsT, AllocatorT>>
+{
+  static_assert(sizeof(CharT) == 1, "only narrow strings have a protobuf wire encoding");
+
+  using StringT = std::basic_string<CharT, TraitsT, AllocatorT>;
+
+  static constexpr WireType wire = WireType::length_delimited;
+
+  static bool is_default(const StringT& value) { return value.empty(); }
+
+  static std::size_t size(const StringT& value) { return varint_size(value.size()) + value.size(); }
+
+  static char* write(char* out, const StringT& value)
+  {
+    out = write_varint(out, value.size());
+    std::memcpy(out, value.data(), value.size());
+    return out + value.size();
+  }
+
+  static void read(Reader& reader, StringT& value)
+  {
+    const Reader payload = reader.read_length_delimited();
+    value.assign(reinterpret_cast<const CharT*>(payload.data()), payload.size());
+  }
+};
+
+/// Nested reflected classes, as embedded messages; always written, even if all members are default
+template <typename T> struct Codec<T, std::enable_if_t<is_reflected_class<T>>>
+{
+  static constexpr WireType wire = WireType::length_delimited;
+
+  static bool is_default(const T& value) { return false; }
+
+  static std::size_t size(const T& value)
+  {
+    const std::size_t n = message_size(value);
+    return varint_size(n) + n;
+  }
+
+  static char* write(char* out, const T& value)
+  {
+    out = write_varint(out, message_size(value));
+    return write_message(out, value);
+  }
+
+  static void read(Reader& reader, T& value) { read_message(reader.read_length_delimited(), value); }
+};
+
+template <std::uint32_t Number, WireType Wire> struct Tag
+{
+  static constexpr std::uint64_t value = (static_cast<std::uint64_t>(Number) << 3) | static_cast<std::uint32_t>(Wire);
+  static constexpr std::size_t size = varint_size(value);
+};
+
+/// Encodings of one field, including its tag; default values are not written
+template <std::uint32_t Number, typename T> struct Field
+{
+  using CodecT = Codec<T>;
+  using TagT = Tag<Number, CodecT::wire>;
+
+  static std::size_t size(const T& value) { return CodecT::is_default(value) ? 0 : (TagT::size + CodecT::size(value)); }
+
+  static char* write(char* out, const T& value)
+  {
+    if (CodecT::is_default(value))
+    {
+      return out;
+    }
+    return CodecT::write(write_varint(out, TagT::value), value);
+  }
+
+  /// Reads the field, or skips it, as an unknown field, if it has a different wire type
+  static void read(Reader& reader, const WireType wire, T& value)
+  {
+    if (wire != CodecT::wire)
+    {
+      reader.skip(wire);
+      return;
+    }
+    CodecT::read(reader, value);
+  }
+};
+
+/// Repeated scalars, packed; unpacked elements are also accepted when reading, and other wire types are skipped
+template <std::uint32_t Number, typename T, typename AllocatorT> struct PackedField
+{
+  using CodecT = Codec<T>;
+  using TagT = Tag<Number, WireType::length_delimited>;
+
+  static std::size_t payload_size(const std::vector<T, AllocatorT>& values)
+  {
+    std::size_t n = 0;
+    for (const T value : values)
+    {
+      n += CodecT::size(value);
+    }
+    return n;
+  }
+
+  static std::size_t size(const std::vector<T, AllocatorT>& values)
+  {
+    if (values.empty())
+    {
+      return 0;
+    }
+    const std::size_t n = payload_size(values);
+    return TagT::size + varint_size(n) + n;
+  }
+
+  static char* write(char* out, const std::vector<T, AllocatorT>& values)
+  {
+    if (values.empty())
+    {
+      return out;
+    }
+    out = write_varint(write_varint(out, TagT::value), payload_size(values));
+    for (const T value : values)
+    {
+      out = CodecT::write(out, value);
+    }
+    return out;
+  }
+
+  static void read(Reader& reader, const WireType wire, std::vector<T, AllocatorT>& values)
+  {
+    if (wire == CodecT::wire)
+    {
+      T value{};
+      CodecT::read(reader, value);
+      values.push_back(value);
+      return;
+    }
+    if (wire != WireType::length_delimited)
+    {
+      reader.skip(wire);
+      return;
+    }
+    Reader payload = reader.read_length_delimited();
+    while (!payload.done())
+    {
+      T value{};
+      CodecT::read(payload, value);
+      values.push_back(value);
+    }
+  }
+};
+
+/// Repeated strings and messages, one tagged field per element; other wire types are skipped when reading
+template <std::uint32_t Number, typename T, typename AllocatorT> struct RepeatedField
+{
+  using CodecT = Codec<T>;
+  using TagT = Tag<Number, WireType::length_delimited>;
+
+  static std::size_t size(const std::vector<T, AllocatorT>& values)
+  {
+    std::size_t n = values.size() * TagT::size;
+    for (const auto& value : values)
+    {
+      n += CodecT::size(value);
+    }
+    return n;
+  }
+
+  static char* write(char* out, const std::vector<T, AllocatorT>& values)
+  {
+    for (const auto& value : values)
+    {
+      out = CodecT::write(write_varint(out, TagT::value), value);
+    }
+    return out;
+  }
+
+  static void read(Reader& reader, const WireType wire, std::vector<T, AllocatorT>& values)
+  {
+    if (wire != WireType::length_delimited)
+    {
+      reader.skip(wire);
+      return;
+    }
+    values.emplace_back();
+    CodecT::read(reader, values.back());
+  }
+};
+
+template <std::uint32_t Number, typename T, typename AllocatorT>
+struct Field<Number, std::vector<T, AllocatorT>>
+    : std::conditional_t<
+        Codec<T>::wire == WireType::length_delimited,
+        RepeatedField<Number, T, AllocatorT>,
+        PackedField<Number, T, AllocatorT>>
+{};
+
+template <typename T, std::size_t I>
+using MemberField = Field<MemberFieldNumber<T, I>::value, typename std::tuple_element_t<I, public_var_info_t<T>>::type>;
+
+template <typename T, std::size_t... Is> std::size_t message_size(const T& value, index_sequence<Is...> _)
+{
+  const auto vars = ::about::detail::get_public_vars_unrecorded(value);
+  std::size_t n = 0;
+  [[maybe_unused]] const auto __list =
+    std::initializer_list<int>{0, (n += MemberField<T, Is>::size(std::get<Is>(vars)), 0)...};
+  return n;
+}
+
+template <typename T, std::size_t... Is> char* write_message(char* out, const T& value, index_sequence<Is...> _)
+{
+  const auto vars = ::about::detail::get_public_vars_unrecorded(value);
+  [[maybe_unused]] const auto __list =
+    std::initializer_list<int>{0, (out = MemberField<T, Is>::write(out, std::get<Is>(vars)), 0)...};
+  return out;
+}
+
+template <typename T, std::size_t... Is> void read_message(Reader reader, T& value, index_sequence<Is...> _)
+{
+  const auto vars = ::about::detail::get_public_vars_unrecorded(value);
+  while (!reader.done())
+  {
+    const std::uint64_t tag = reader.read_varint();
+    const auto number = static_cast<std::uint32_t>(tag >> 3);
+    const auto wire = static_cast<WireType>(tag & 0x7);
+
+    bool matched = false;
+    [[maybe_unused]] const auto __list = std::initializer_list<int>{
+      0,
+      ((!matched && number == MemberFieldNumber<T, Is>::value)
+         ? (MemberField<T, Is>::read(reader, wire, std::get<Is>(vars)), matched = true, 0)
+         : 0)...};
+    if (!matched)
+    {
+      reader.skip(wire);
+    }
+  }
+}
+
+template <typename T> using member_indices_t = make_index_sequence<std::tuple_size<public_var_info_t<T>>::value>;
+
+template <typename T> std::size_t message_size(const T& value) { return message_size(value, member_indices_t<T>{}); }
+
+template <typename T> char* write_message(char* out, const T& value)
+{
+  return write_message(out, value, member_indices_t<T>{});
+}
+
+template <typename T> void read_message(Reader reader, T& value) { read_message(reader, value, member_indices_t<T>{}); }
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Protobuf field number of the public member of \c T named by a tag
+ *
+ * Field numbers are assigned in order of declaration, starting from 1, unless overridden with
+ * <code>ABOUT_FIELD_NUMBER</code> (see <code>about.hpp</code>).
+ *
+ * @code{.cpp}
+ * static_assert(about::protobuf::field_number<Quote>("price"_var) == 10, "");
+ * @endcode
+ */
+template <typename T, char... Chars> constexpr std::uint32_t field_number(::about::detail::VarName<Chars...> tag)
+{
+  return detail::MemberFieldNumber<T, ::about::var_index<T>(tag)>::value;
+}
+
+/**
+ * @brief Returns number of bytes written by <code>encode(value)</code>
+ */
+template <typename T> std::size_t encoded_size(const T& value)
+{
+  static_assert(is_reflected_class<T>, "protobuf messages must be reflected class types");
+  return detail::message_size(value);
+}
+
+/**
+ * @brief Appends \c value to \c out as a protobuf message, in wire format
+ *
+ * Each public member is written as one field, numbered as by <code>field_number</code>:
+ *
+ * | member type                                         | protobuf type                           |
+ * |-----------------------------------------------------|-----------------------------------------|
+ * | <code>bool</code>                                   | <code>bool</code>                       |
+ * | signed / unsigned integers, <code>enum</code>        | <code>int64</code> / <code>uint64</code> (wire compatible with 32-bit) |
+ * | <code>float</code>, <code>double</code>             | <code>float</code>, <code>double</code> |
+ * | <code>std::string</code>                            | <code>string</code>, <code>bytes</code> |
+ * | reflected class                                     | embedded message                        |
+ * | <code>std::vector</code> of the above               | <code>repeated</code> (scalars packed)   |
+ *
+ * As in proto3, scalar members with default values and empty strings and vectors are not written.
+ */
+template <typename T> void encode(const T& value, std::string& out)
+{
+  const std::size_t offset = out.size();
+  out.resize(offset + encoded_size(value));
+  detail::write_message(&out[offset], value);
+}
+
+/**
+ * @brief Returns \c value encoded as a protobuf message
+ *
+ * @copydetails encode(const T&, std::string&)
+ */
+template <typename T> std::string encode(const T& value)
+{
+  std::string out;
+  encode(value, out);
+  return out;
+}
+
+/**
+ * @brief Decodes protobuf message from <code>[data, data + size)</code> into \c value
+ *
+ * Fields are matched to members by field number. As by other protobuf parsers, fields with unknown numbers, or with a
+ * wire type which does not match their member (e.g. after the field was retyped), are skipped. Members without a field
+ * in the input keep their value; repeated fields are appended, and embedded messages are merged, as by
+ * <code>MergeFromString</code>.
+ *
+ * @throws std::runtime_error  if input is truncated or malformed
+ */
+template <typename T> void decode(const char* data, const std::size_t size, T& value)
+{
+  static_assert(is_reflected_class<T>, "protobuf messages must be reflected class types");
+  detail::read_message(detail::Reader{data, data + size}, value);
+}
+
+/**
+ * @brief Returns value-initialized \c T, decoded from protobuf message \c bytes
+ *
+ * @throws std::runtime_error  if input is truncated or malformed
+ */
+template <typename T> T decode(const std::string& bytes)
+{
+  T value{};
+  decode(bytes.data(), bytes.size(), value);
+  return value;
+}
+
+}  // namespace protobuf
+}  // namespace about
+
+#endif  // ABOUT_PROTOBUF_HPP
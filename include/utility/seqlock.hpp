@@ -0,0 +1,125 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_SEQLOCK_HPP
+#define ABOUT_SEQLOCK_HPP
+
+// C++ Standard Library
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace about
+{
+
+/**
+ * @brief Publishes snapshots of an object from a single writer thread to any number of reader threads, without locks
+ *
+ * The object is held as an array of atomic machine words. <code>store</code> bumps a version counter to an odd value,
+ * writes every word with a relaxed atomic store, then bumps the version again. <code>load</code> copies every word with
+ * a relaxed atomic load and retries if the version changed (or was odd) in the meantime. All shared accesses are
+ * atomic, so the copy is free of data races, and torn copies are never returned.
+ *
+ * A torn copy may be read before it is discarded, which is only harmless if \c T is trivially copyable. That also makes
+ * every member of \c T trivially copyable, so the whole object is copied as one contiguous run of words rather than
+ * member-by-member.
+ *
+ * @code{.cpp}
+ * about::seqlock<MarketState> state;
+ * state.store(next);               // writer thread
+ * const auto current = state.load();  // any reader thread
+ * @endcode
+ *
+ * @tparam T  trivially-copyable type to publish
+ */
+template <typename T> class seqlock
+{
+  static_assert(std::is_trivially_copyable<T>::value, "seqlock requires a trivially-copyable type");
+
+public:
+  seqlock() : seqlock{T{}} {}
+
+  explicit seqlock(const T& value) { write_words(value); }
+
+  seqlock(const seqlock&) = delete;
+  seqlock& operator=(const seqlock&) = delete;
+
+  /**
+   * @brief Publishes \c value
+   *
+   * @warning must only be called from one thread at a time
+   */
+  void store(const T& value)
+  {
+    const std::uint64_t version = version_.load(std::memory_order_relaxed);
+    version_.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    write_words(value);
+    version_.store(version + 2, std::memory_order_release);
+  }
+
+  /**
+   * @brief Attempts to copy the most recently published value, once
+   *
+   * @return \c false if a concurrent <code>store</code> was observed, in which case \c value is unmodified
+   */
+  bool try_load(T& value) const
+  {
+    std::uint64_t words[kWordCount];
+    const std::uint64_t before = version_.load(std::memory_order_acquire);
+    if (before & 1U)
+    {
+      return false;
+    }
+    for (std::size_t i = 0; i < kWordCount; ++i)
+    {
+      words[i] = words_[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (version_.load(std::memory_order_relaxed) != before)
+    {
+      return false;
+    }
+    std::memcpy(std::addressof(value), words, sizeof(T));
+    return true;
+  }
+
+  /**
+   * @brief Returns a copy of the most recently published value, retrying until a consistent copy is read
+   */
+  T load() const
+  {
+    T value;
+    while (!try_load(value))
+    {}
+    return value;
+  }
+
+  /**
+   * @brief Returns number of completed <code>store</code> calls
+   */
+  std::uint64_t version() const { return version_.load(std::memory_order_acquire) / 2; }
+
+private:
+  static constexpr std::size_t kWordCount = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+  void write_words(const T& value)
+  {
+    std::uint64_t words[kWordCount] = {};
+    std::memcpy(words, std::addressof(value), sizeof(T));
+    for (std::size_t i = 0; i < kWordCount; ++i)
+    {
+      words_[i].store(words[i], std::memory_order_relaxed);
+    }
+  }
+
+  alignas(64) std::atomic<std::uint64_t> version_{0};
+  std::atomic<std::uint64_t> words_[kWordCount];
+};
+
+}  // namespace about
+
+#endif  // ABOUT_SEQLOCK_HPP
@@ -0,0 +1,373 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_SHM_QUEUE_HPP
+#define ABOUT_SHM_QUEUE_HPP
+
+// C++ Standard Library
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+// POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// About
+#include <about/about.hpp>
+
+namespace about
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+static constexpr std::uint64_t kFnvOffset = 14695981039346656037ULL;
+static constexpr std::uint64_t kFnvPrime = 1099511628211ULL;
+
+constexpr std::uint64_t fnv1a(std::uint64_t hash, const char* str)
+{
+  while (*str != '\0')
+  {
+    hash = (hash ^ static_cast<unsigned char>(*str++)) * kFnvPrime;
+  }
+  return hash;
+}
+
+constexpr std::uint64_t fnv1a(std::uint64_t hash, std::uint64_t value)
+{
+  for (int i = 0; i < 8; ++i, value >>= 8)
+  {
+    hash = (hash ^ (value & 0xFFU)) * kFnvPrime;
+  }
+  return hash;
+}
+
+/// Order-dependent combination of already-hashed parts
+constexpr std::uint64_t fnv1a(std::uint64_t hash, std::initializer_list<std::uint64_t> parts)
+{
+  for (const auto part : parts)
+  {
+    hash = fnv1a(hash, part);
+  }
+  return hash;
+}
+
+template <typename T, typename Enable = void> struct LayoutHash
+{
+  static constexpr std::uint64_t value = fnv1a(
+    kFnvOffset,
+    {sizeof(T),
+     alignof(T),
+     static_cast<std::uint64_t>(std::is_floating_point<T>::value),
+     static_cast<std::uint64_t>(std::is_signed<T>::value),
+     static_cast<std::uint64_t>(std::is_enum<T>::value),
+     static_cast<std::uint64_t>(std::is_pointer<T>::value)});
+};
+
+template <typename InfoT> constexpr std::uint64_t member_layout_hash()
+{
+  return fnv1a(fnv1a(kFnvOffset, InfoT::name), LayoutHash<typename InfoT::type>::value);
+}
+
+template <typename T, typename InfoTupleT> struct ClassLayoutHash;
+
+template <typename T, typename... InfoTs> struct ClassLayoutHash<T, std::tuple<InfoTs...>>
+{
+  static constexpr std::uint64_t value = fnv1a(
+    fnv1a(kFnvOffset, ClassMetaInfo<T>::absolute_name),
+    {sizeof(T), alignof(T), sizeof...(InfoTs), member_layout_hash<InfoTs>()...});
+};
+
+template <typename T>
+struct LayoutHash<T, std::enable_if_t<std::is_class<T>::value && has_reflection_info<T>>>
+    : ClassLayoutHash<T, public_var_info_t<T>>
+{};
+
+static constexpr std::uint64_t kShmQueueMagic = 0x4142545348514531ULL;  // "ABTSHQE1"
+
+/**
+ * @brief Shared-memory segment header; immediately followed by slots
+ */
+struct ShmQueueHeader
+{
+  std::atomic<std::uint64_t> magic;
+  std::uint64_t layout_hash;
+  std::uint64_t slot_size;
+  std::uint64_t slot_alignment;
+  std::uint64_t capacity;
+  alignas(64) std::atomic<std::uint64_t> enqueue_pos;
+  alignas(64) std::atomic<std::uint64_t> dequeue_pos;
+};
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Compile-time hash of the layout of \c T
+ *
+ * For reflected classes, combines the absolute class name, size and alignment with the name and layout hash of every
+ * public member, recursively. For other types, combines size, alignment and the kind of value (floating point, signed,
+ * enum, pointer). Builds which disagree on any of these produce different hashes.
+ *
+ * @tparam T  type to hash
+ */
+template <typename T> constexpr std::uint64_t layout_hash() { return detail::LayoutHash<detail::cleaned_t<T>>::value; }
+
+/**
+ * @brief Bounded queue of \c T living in a POSIX shared-memory segment, for passing records between local processes
+ *
+ * The segment holds a header followed by a fixed number of slots, each sized and aligned for one \c T plus a sequence
+ * counter. The header records <code>layout_hash<T>()</code>, so attaching with a build of \c T which differs from the
+ * creator's is detected up front rather than corrupting records.
+ *
+ * <code>try_push</code> and <code>try_pop</code> are wait-free with one producer and one consumer. Several producer
+ * processes may push concurrently (lock-free), but there must be only one consumer.
+ *
+ * @code{.cpp}
+ * // process A
+ * auto queue = about::shm_queue<Quote>::create("/quotes", 4096);
+ * queue.try_push(quote);
+ *
+ * // process B
+ * auto queue = about::shm_queue<Quote>::attach("/quotes");
+ * Quote quote;
+ * while (!queue.try_pop(quote)) {}
+ * @endcode
+ *
+ * @tparam T  trivially-copyable record type
+ */
+template <typename T> class shm_queue
+{
+  static_assert(std::is_trivially_copyable<T>::value, "shm_queue requires a trivially-copyable type");
+  static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shm_queue requires address-free 64-bit atomics");
+
+public:
+  /**
+   * @brief Creates (or replaces) shared-memory segment \c name, with room for at least \c capacity records
+   *
+   * @throws std::runtime_error  if segment could not be created or mapped
+   */
+  static shm_queue create(const std::string& name, const std::size_t capacity)
+  {
+    std::uint64_t slots = 1;
+    while (slots < capacity)
+    {
+      slots <<= 1;
+    }
+
+    const std::size_t bytes = kSlotOffset + slots * sizeof(Slot);
+    const int fd = ::shm_open(name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0600);
+    if (fd < 0)
+    {
+      throw std::runtime_error{"shm_queue: failed to create " + name};
+    }
+    if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0)
+    {
+      ::close(fd);
+      throw std::runtime_error{"shm_queue: failed to size " + name};
+    }
+
+    shm_queue queue{fd, bytes, name};
+    auto* const header = new (queue.base_) detail::ShmQueueHeader;
+    header->layout_hash = layout_hash<T>();
+    header->slot_size = sizeof(Slot);
+    header->slot_alignment = alignof(Slot);
+    header->capacity = slots;
+    header->enqueue_pos.store(0, std::memory_order_relaxed);
+    header->dequeue_pos.store(0, std::memory_order_relaxed);
+    for (std::uint64_t i = 0; i < slots; ++i)
+    {
+      auto* const slot = new (queue.base_ + kSlotOffset + i * sizeof(Slot)) Slot;
+      slot->sequence.store(i, std::memory_order_relaxed);
+    }
+    header->magic.store(detail::kShmQueueMagic, std::memory_order_release);
+
+    queue.bind();
+    return queue;
+  }
+
+  /**
+   * @brief Attaches to existing shared-memory segment \c name
+   *
+   * @throws std::runtime_error  if segment does not exist, is not initialized, or was created for a type whose layout
+   *                             differs from \c T
+   */
+  static shm_queue attach(const std::string& name)
+  {
+    const int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0)
+    {
+      throw std::runtime_error{"shm_queue: failed to open " + name};
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < kSlotOffset)
+    {
+      ::close(fd);
+      throw std::runtime_error{"shm_queue: invalid segment " + name};
+    }
+
+    shm_queue queue{fd, static_cast<std::size_t>(st.st_size), name};
+    const auto* const header = reinterpret_cast<const detail::ShmQueueHeader*>(queue.base_);
+    if (header->magic.load(std::memory_order_acquire) != detail::kShmQueueMagic)
+    {
+      throw std::runtime_error{"shm_queue: segment " + name + " is not initialized"};
+    }
+    if (header->layout_hash != layout_hash<T>() || header->slot_size != sizeof(Slot) ||
+        header->slot_alignment != alignof(Slot))
+    {
+      throw std::runtime_error{"shm_queue: segment " + name + " was created for a different record layout"};
+    }
+    if (header->capacity == 0 || (header->capacity & (header->capacity - 1)) != 0 ||
+        kSlotOffset + header->capacity * sizeof(Slot) > queue.size_)
+    {
+      throw std::runtime_error{"shm_queue: segment " + name + " has an invalid capacity"};
+    }
+
+    queue.bind();
+    return queue;
+  }
+
+  /**
+   * @brief Removes shared-memory segment \c name; existing mappings remain valid until destroyed
+   */
+  static void remove(const std::string& name) { ::shm_unlink(name.c_str()); }
+
+  shm_queue(shm_queue&& other) noexcept :
+      base_{other.base_},
+      size_{other.size_},
+      header_{other.header_},
+      slots_{other.slots_},
+      mask_{other.mask_},
+      name_{std::move(other.name_)}
+  {
+    other.base_ = nullptr;
+  }
+
+  shm_queue(const shm_queue&) = delete;
+  shm_queue& operator=(const shm_queue&) = delete;
+  shm_queue& operator=(shm_queue&&) = delete;
+
+  ~shm_queue()
+  {
+    if (base_ != nullptr)
+    {
+      ::munmap(base_, size_);
+    }
+  }
+
+  /**
+   * @brief Enqueues a copy of \c value
+   *
+   * @return \c false if the queue is full
+   */
+  bool try_push(const T& value)
+  {
+    std::uint64_t pos = header_->enqueue_pos.load(std::memory_order_relaxed);
+    while (true)
+    {
+      Slot& slot = slots_[pos & mask_];
+      const std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::int64_t>(sequence - pos);
+      if (diff == 0)
+      {
+        if (header_->enqueue_pos.compare_exchange_strong(pos, pos + 1, std::memory_order_relaxed))
+        {
+          std::memcpy(std::addressof(slot.value), std::addressof(value), sizeof(T));
+          slot.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0)
+      {
+        return false;
+      }
+      else
+      {
+        pos = header_->enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief Dequeues the oldest record into \c value
+   *
+   * @return \c false if the queue is empty, in which case \c value is unmodified
+   *
+   * @warning must only be called by one consumer at a time
+   */
+  bool try_pop(T& value)
+  {
+    const std::uint64_t pos = header_->dequeue_pos.load(std::memory_order_relaxed);
+    Slot& slot = slots_[pos & mask_];
+    if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+    {
+      return false;
+    }
+    std::memcpy(std::addressof(value), std::addressof(slot.value), sizeof(T));
+    slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+    header_->dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /**
+   * @brief Returns maximum number of queued records
+   */
+  std::size_t capacity() const { return mask_ + 1; }
+
+  /**
+   * @brief Returns name of the shared-memory segment
+   */
+  const std::string& name() const { return name_; }
+
+private:
+  struct Slot
+  {
+    std::atomic<std::uint64_t> sequence;
+    T value;
+  };
+
+  static constexpr std::size_t kSlotOffset =
+    ((sizeof(detail::ShmQueueHeader) + alignof(Slot) - 1) / alignof(Slot)) * alignof(Slot);
+
+  /// Takes ownership of \c fd and maps it
+  shm_queue(const int fd, const std::size_t size, const std::string& name) : size_{size}, name_{name}
+  {
+    void* const mapped = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED)
+    {
+      throw std::runtime_error{"shm_queue: failed to map " + name};
+    }
+    base_ = static_cast<char*>(mapped);
+  }
+
+  void bind()
+  {
+    header_ = reinterpret_cast<detail::ShmQueueHeader*>(base_);
+    slots_ = reinterpret_cast<Slot*>(base_ + kSlotOffset);
+    mask_ = header_->capacity - 1;
+  }
+
+  char* base_ = nullptr;
+  std::size_t size_ = 0;
+  detail::ShmQueueHeader* header_ = nullptr;
+  Slot* slots_ = nullptr;
+  std::uint64_t mask_ = 0;
+  std::string name_;
+};
+
+}  // namespace about
+
+#endif  // ABOUT_SHM_QUEUE_HPP
@@ -0,0 +1,256 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_SORT_HPP
+#define ABOUT_SORT_HPP
+
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// About
+#include <about/about.hpp>
+#include <about/flatten.hpp>
+#include <about/parallel.hpp>
+#include <about/var.hpp>
+
+namespace about
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/**
+ * @brief Writes a value as big-endian, fixed-width bytes which compare (with <code>memcmp</code>) like the value
+ */
+template <typename T, typename Enable = void> struct RadixKey
+{
+  static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "sort_by keys must be arithmetic or enum members");
+};
+
+template <typename T> inline unsigned char* write_big_endian(unsigned char* out, T bits)
+{
+  for (std::size_t i = sizeof(T); i-- > 0;)
+  {
+    out[i] = static_cast<unsigned char>(bits & 0xFFU);
+    bits >>= 8;
+  }
+  return out + sizeof(T);
+}
+
+template <typename T> struct RadixKey<T, std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value>>
+{
+  static constexpr std::size_t size = sizeof(T);
+
+  static unsigned char* write(unsigned char* out, const T value) { return write_big_endian(out, value); }
+};
+
+/// Flips the sign bit, so negative values order before positive values
+template <typename T> struct RadixKey<T, std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value>>
+{
+  using bits_type = std::make_unsigned_t<T>;
+
+  static constexpr std::size_t size = sizeof(T);
+
+  static unsigned char* write(unsigned char* out, const T value)
+  {
+    static constexpr bits_type kSignBit = bits_type{1} << (8 * sizeof(T) - 1);
+    return write_big_endian(out, static_cast<bits_type>(static_cast<bits_type>(value) ^ kSignBit));
+  }
+};
+
+/// Sets the sign bit of positive values, and inverts all bits of negative values, giving IEEE-754 total order
+template <typename T> struct RadixKey<T, std::enable_if_t<std::is_floating_point<T>::value>>
+{
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8, "sort_by supports float and double keys");
+
+  using bits_type = typename std::conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type;
+
+  static constexpr std::size_t size = sizeof(T);
+
+  static unsigned char* write(unsigned char* out, const T value)
+  {
+    static constexpr bits_type kSignBit = bits_type{1} << (8 * sizeof(T) - 1);
+    bits_type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return write_big_endian(out, static_cast<bits_type>((bits & kSignBit) ? ~bits : (bits | kSignBit)));
+  }
+};
+
+/// Enums order by underlying value
+template <typename T> struct RadixKey<T, std::enable_if_t<std::is_enum<T>::value>>
+{
+  using underlying_type = std::underlying_type_t<T>;
+
+  static constexpr std::size_t size = sizeof(underlying_type);
+
+  static unsigned char* write(unsigned char* out, const T value)
+  {
+    return RadixKey<underlying_type>::write(out, static_cast<underlying_type>(value));
+  }
+};
+
+/**
+ * @brief Concatenated key of several members of \c T, and the position of its record before sorting
+ */
+template <std::size_t KeyBytes, typename IndexT> struct RadixEntry
+{
+  unsigned char key[KeyBytes];
+  IndexT index;
+};
+
+/**
+ * @brief Stable LSD radix sort of \c entries, one byte per pass, from the last key byte to the first
+ *
+ * Each pass splits \c entries into one contiguous chunk per thread. Threads count bytes of their chunk, then scatter
+ * their chunk to per-thread offsets within each bucket, which preserves stability. Passes where every entry has the
+ * same byte are skipped.
+ */
+template <std::size_t KeyBytes, typename IndexT>
+void radix_sort(std::vector<RadixEntry<KeyBytes, IndexT>>& entries, const std::size_t thread_count)
+{
+  using Counts = std::array<std::size_t, 256>;
+
+  const std::size_t n = entries.size();
+  const std::size_t chunk = (n + thread_count - 1) / thread_count;
+  std::vector<RadixEntry<KeyBytes, IndexT>> buffer(n);
+  std::vector<Counts> counts(thread_count);
+
+  for (std::size_t byte = KeyBytes; byte-- > 0;)
+  {
+    run_parallel(thread_count, [&](const std::size_t t) {
+      auto& c = counts[t];
+      c.fill(0);
+      for (std::size_t i = t * chunk, last = std::min(n, i + chunk); i < last; ++i)
+      {
+        ++c[entries[i].key[byte]];
+      }
+    });
+
+    std::size_t offset = 0;
+    bool single_bucket = false;
+    for (std::size_t b = 0; b < 256; ++b)
+    {
+      std::size_t bucket_total = 0;
+      for (auto& c : counts)
+      {
+        const std::size_t count = c[b];
+        c[b] = offset;
+        offset += count;
+        bucket_total += count;
+      }
+      single_bucket = single_bucket || (bucket_total == n);
+    }
+    if (single_bucket)
+    {
+      continue;
+    }
+
+    run_parallel(thread_count, [&](const std::size_t t) {
+      auto& c = counts[t];
+      for (std::size_t i = t * chunk, last = std::min(n, i + chunk); i < last; ++i)
+      {
+        buffer[c[entries[i].key[byte]]++] = entries[i];
+      }
+    });
+    entries.swap(buffer);
+  }
+}
+
+template <typename T, typename... TagTs> struct SortKeyBytes
+{
+  static constexpr std::size_t value = partial_sum({RadixKey<var_t<T, TagTs>>::size...}, sizeof...(TagTs));
+};
+
+template <typename IndexT, typename T, typename AllocatorT, typename... TagTs>
+void sort_by(std::vector<T, AllocatorT>& values, const std::size_t thread_count, TagTs... tags)
+{
+  static constexpr std::size_t kKeyBytes = SortKeyBytes<T, TagTs...>::value;
+  using Entry = RadixEntry<kKeyBytes, IndexT>;
+
+  const std::size_t n = values.size();
+  const std::size_t chunk = (n + thread_count - 1) / thread_count;
+  std::vector<Entry> entries(n);
+  run_parallel(thread_count, [&](const std::size_t t) {
+    for (std::size_t i = t * chunk, last = std::min(n, i + chunk); i < last; ++i)
+    {
+      unsigned char* out = entries[i].key;
+      [[maybe_unused]] const auto __list = std::initializer_list<int>{
+        0, (out = RadixKey<var_t<T, TagTs>>::write(out, ::about::detail::get_var_unrecorded(values[i], tags)), 0)...};
+      entries[i].index = static_cast<IndexT>(i);
+    }
+  });
+
+  if (n < 256UL)
+  {
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+      return std::memcmp(lhs.key, rhs.key, kKeyBytes) < 0;
+    });
+  }
+  else
+  {
+    radix_sort(entries, thread_count);
+  }
+
+  std::vector<T, AllocatorT> sorted{values.get_allocator()};
+  sorted.reserve(n);
+  for (const auto& entry : entries)
+  {
+    sorted.emplace_back(std::move(values[entry.index]));
+  }
+  values.swap(sorted);
+}
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Minimum number of records handled by each thread of <code>sort_by</code>
+ */
+static constexpr std::size_t sort_by_records_per_thread = 1UL << 18;
+
+/**
+ * @brief Stable sort of reflected records by one or more members, in order of precedence
+ *
+ * Each record is given a fixed-width key: the named members, encoded as bytes which order the same way as the members
+ * (integers with the sign bit flipped, floats in IEEE-754 total order, enums by underlying value). Keys are sorted by
+ * an LSD radix sort, using up to <code>std::thread::hardware_concurrency()</code> threads for large inputs, then
+ * records are moved into sorted order once.
+ *
+ * @code{.cpp}
+ * about::sort_by(poses, "id"_var, "stamp"_var);
+ * @endcode
+ *
+ * @param values  records to sort, in place
+ * @param tags...  names of arithmetic or enum members, e.g. <code>"id"_var</code>
+ */
+template <typename T, typename AllocatorT, typename... TagTs>
+void sort_by(std::vector<T, AllocatorT>& values, TagTs... tags)
+{
+  static_assert(is_reflected_class<T>, "sort_by requires a reflected class type");
+  static_assert(sizeof...(TagTs) > 0, "sort_by requires at least one member name");
+
+  const std::size_t thread_count = detail::parallel_thread_count(values.size(), sort_by_records_per_thread);
+
+  if (values.size() <= std::numeric_limits<std::uint32_t>::max())
+  {
+    detail::sort_by<std::uint32_t>(values, thread_count, tags...);
+  }
+  else
+  {
+    detail::sort_by<std::uint64_t>(values, thread_count, tags...);
+  }
+}
+
+}  // namespace about
+
+#endif  // ABOUT_SORT_HPP
@@ -0,0 +1,120 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+#ifndef ABOUT_VAR_HPP
+#define ABOUT_VAR_HPP
+
+// C++ Standard Library
+#include <cstddef>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+
+// About
+#include <about/about.hpp>
+
+namespace about
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+constexpr bool names_equal(const char* lhs, const char* rhs)
+{
+  while (*lhs != '\0' && *lhs == *rhs)
+  {
+    ++lhs;
+    ++rhs;
+  }
+  return *lhs == *rhs;
+}
+
+/// Index of \c name within \c names, or <code>names.size()</code>
+constexpr std::size_t find_name(const char* name, std::initializer_list<const char*> names)
+{
+  std::size_t i = 0;
+  for (const auto candidate : names)
+  {
+    if (names_equal(name, candidate))
+    {
+      return i;
+    }
+    ++i;
+  }
+  return i;
+}
+
+/// Null-terminated string spelled by a tag
+template <typename TagT> struct TagString;
+
+template <char... Chars> struct TagString<VarName<Chars...>>
+{
+  static constexpr char value[] = {Chars..., '\0'};
+};
+
+template <char... Chars> constexpr char TagString<VarName<Chars...>>::value[];
+
+/// Index of the public member of \c T named by \c TagT, or the number of public members
+template <typename T, typename TagT, typename InfoTupleT = public_var_info_t<T>> struct VarIndex;
+
+template <typename T, typename TagT, typename... InfoTs> struct VarIndex<T, TagT, std::tuple<InfoTs...>>
+{
+  static constexpr std::size_t value = find_name(TagString<TagT>::value, {InfoTs::name...});
+  static constexpr bool found = value < sizeof...(InfoTs);
+};
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Index, in order of declaration, of the public member of \c T named by a tag
+ *
+ * @code{.cpp}
+ * static_assert(about::var_index<my_ns::MyClass>("c"_var) == 2, "");
+ * @endcode
+ *
+ * @tparam T  reflected class type
+ */
+template <typename T, char... Chars> constexpr std::size_t var_index(detail::VarName<Chars...> _)
+{
+  static_assert(
+    detail::VarIndex<detail::cleaned_t<T>, detail::VarName<Chars...>>::found, "no public member with this name");
+  return detail::VarIndex<detail::cleaned_t<T>, detail::VarName<Chars...>>::value;
+}
+
+/**
+ * @brief Type of the public member of \c T named by \c TagT, e.g. <code>var_t<MyClass, decltype("c"_var)></code>
+ */
+template <typename T, typename TagT>
+using var_t = typename std::tuple_element_t<detail::VarIndex<detail::cleaned_t<T>, TagT>::value, public_var_info_t<T>>::type;
+
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/// Like <code>about::get_var</code>, without recording the access; for use by About utilities
+template <typename T, char... Chars> constexpr decltype(auto) get_var_unrecorded(T& value, VarName<Chars...> tag)
+{
+  return std::get<var_index<T>(tag)>(get_public_vars_unrecorded(value));
+}
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+/**
+ * @brief Returns a reference to the public member of \c value named by a tag
+ *
+ * @code{.cpp}
+ * about::get_var(obj, "c"_var) = 1.0;
+ * @endcode
+ */
+template <typename T, char... Chars> ABOUT_PROFILED_CONSTEXPR decltype(auto) get_var(T& value, detail::VarName<Chars...> tag)
+{
+  ABOUT_RECORD_FIELD_ACCESS(detail::cleaned_t<T>, value, detail::member_mask<var_index<T>(tag)>());
+  return detail::get_var_unrecorded(value, tag);
+}
+
+}  // namespace about
+
+#endif  // ABOUT_VAR_HPP
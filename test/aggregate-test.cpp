@@ -0,0 +1,140 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/aggregate.hpp>
+#include <about/fmt.hpp>
+
+using namespace about;
+
+namespace
+{
+
+std::vector<my_ns::WirePose> make_poses(const std::size_t n)
+{
+  std::vector<my_ns::WirePose> poses(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    poses[i].id = static_cast<int>(i % 1000) - 500;
+    poses[i].x = static_cast<float>(i % 7) * 0.5f;
+    poses[i].y = -static_cast<float>(i % 3);
+    poses[i].z = 1.0f;
+    poses[i].stamp = static_cast<double>(i);
+    poses[i].scale.real_number = 2.0f;
+    poses[i].sequence = static_cast<int>(i);
+  }
+  return poses;
+}
+
+void expect_stats_near(const field_stats& actual, const field_stats& expected)
+{
+  EXPECT_EQ(actual.count, expected.count);
+  EXPECT_DOUBLE_EQ(actual.sum, expected.sum);
+  EXPECT_DOUBLE_EQ(actual.min, expected.min);
+  EXPECT_DOUBLE_EQ(actual.max, expected.max);
+  EXPECT_DOUBLE_EQ(actual.mean, expected.mean);
+}
+
+}  // namespace
+
+TEST(Aggregate, FieldStatsIsReflected)
+{
+  static_assert(has<field_stats>("mean"_var), "");
+
+  std::ostringstream oss;
+  oss << fmt(field_stats{2, 3.0, 1.0, 2.0, 1.5});
+  EXPECT_NE(oss.str().find("\"mean\" : 1.5"), std::string::npos);
+}
+
+TEST(Aggregate, Names)
+{
+  EXPECT_EQ(aggregate_result<my_ns::MyClass>::size, 5UL);
+  EXPECT_EQ(
+    aggregate_result<my_ns::MyClass>::names(),
+    (std::vector<std::string>{"a", "b", "c", "d.a.real_number", "d.b.real_number"}));
+}
+
+TEST(Aggregate, Records)
+{
+  const auto poses = make_poses(1003);
+  const auto stats = aggregate(poses);
+
+  double id_sum = 0.0;
+  for (const auto& pose : poses)
+  {
+    id_sum += pose.id;
+  }
+
+  expect_stats_near(stats.get("id"_var), field_stats{1003, id_sum, -500.0, 499.0, id_sum / 1003.0});
+  expect_stats_near(stats.get("z"_var), field_stats{1003, 1003.0, 1.0, 1.0, 1.0});
+  expect_stats_near(stats.at("scale.real_number"), field_stats{1003, 2006.0, 2.0, 2.0, 2.0});
+  expect_stats_near(stats.get("stamp"_var), field_stats{1003, 1002.0 * 1003.0 / 2.0, 0.0, 1002.0, 501.0});
+  EXPECT_EQ(stats.get("y"_var).min, -2.0);
+  EXPECT_EQ(stats.get("x"_var).max, 3.0);
+  EXPECT_THROW(stats.at("w"), std::out_of_range);
+}
+
+TEST(Aggregate, Empty)
+{
+  const auto stats = aggregate(std::vector<my_ns::WirePose>{});
+  expect_stats_near(stats.get("id"_var), field_stats{0, 0.0, 0.0, 0.0, 0.0});
+}
+
+TEST(Aggregate, ThreadsMatchSerial)
+{
+  const auto poses = make_poses(4 * aggregate_records_per_thread + 17);
+  const auto serial = aggregate(poses.data(), 1000);
+
+  static constexpr std::size_t kFieldCount = aggregate_result<my_ns::WirePose>::size;
+  const auto parallel = detail::accumulate_parallel<kFieldCount>(
+    1000, 4, [&poses](const std::size_t first, const std::size_t last, detail::StatsAccumulator* stats) {
+      detail::accumulate_records(
+        poses.data() + first, last - first, stats, make_index_sequence<leaf_count<my_ns::WirePose>>{});
+    });
+  for (std::size_t i = 0; i < kFieldCount; ++i)
+  {
+    expect_stats_near(parallel[i], serial[i]);
+  }
+
+  expect_stats_near(aggregate(poses).get("z"_var), field_stats{poses.size(), double(poses.size()), 1.0, 1.0, 1.0});
+}
+
+TEST(Aggregate, ColumnsMatchRecords)
+{
+  const auto poses = make_poses(517);
+
+  leaf_vectors_t<my_ns::WirePose> columns;
+  for (const auto& pose : poses)
+  {
+    for_each_leaf([&columns](auto index, const auto& leaf) { std::get<decltype(index)::value>(columns).push_back(leaf); }, pose);
+  }
+
+  const auto from_records = aggregate(poses);
+  const auto from_columns = aggregate<my_ns::WirePose>(columns);
+  for (std::size_t i = 0; i < aggregate_result<my_ns::WirePose>::size; ++i)
+  {
+    expect_stats_near(from_columns[i], from_records[i]);
+  }
+}
+
+TEST(Aggregate, ColumnsOfDifferentSizes)
+{
+  leaf_vectors_t<my_ns::WirePose> columns;
+  std::get<0>(columns).resize(10);
+  ASSERT_THROW(aggregate<my_ns::WirePose>(columns), std::invalid_argument);
+
+  std::get<6>(columns).resize(10);
+  ASSERT_THROW(aggregate<my_ns::WirePose>(columns), std::invalid_argument);
+}
@@ -0,0 +1,149 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/async_log.hpp>
+
+struct LabeledValue
+{
+  std::string label;
+  int id;
+  double value;
+};
+
+namespace about
+{
+namespace detail
+{
+
+template <> struct ClassMetaInfo<::LabeledValue>
+{
+  static constexpr const char* name = "LabeledValue";
+  static constexpr const char* absolute_name = "LabeledValue";
+
+  struct MemberInfo__LabeledValue__label
+  {
+    using type = std::string;
+    static constexpr const char* name = "label";
+  };
+
+  struct MemberInfo__LabeledValue__id
+  {
+    using type = int;
+    static constexpr const char* name = "id";
+  };
+
+  struct MemberInfo__LabeledValue__value
+  {
+    using type = double;
+    static constexpr const char* name = "value";
+  };
+
+  using public_var_info =
+    std::tuple<MemberInfo__LabeledValue__label, MemberInfo__LabeledValue__id, MemberInfo__LabeledValue__value>;
+
+  static constexpr decltype(auto) public_vars(::LabeledValue& v) { return std::tie(v.label, v.id, v.value); }
+
+  static constexpr decltype(auto) public_vars(const ::LabeledValue& v) { return std::tie(v.label, v.id, v.value); }
+};
+
+}  // namespace detail
+}  // namespace about
+
+using namespace about;
+
+TEST(AsyncLog, FormatsTriviallyCopyable)
+{
+  my_ns::SomethingElse obj{};
+  obj.a.real_number = 1.5f;
+
+  std::ostringstream expected;
+  expected << "SomethingElse " << about::fmt(obj) << '\n';
+
+  std::ostringstream oss;
+  {
+    async_log<> logger{oss};
+    ASSERT_TRUE(logger.log(obj));
+    logger.flush();
+    ASSERT_EQ(oss.str(), expected.str());
+  }
+}
+
+TEST(AsyncLog, FormatsTriviallyCopyableMembersOnly)
+{
+  const LabeledValue obj{"not copied", 7, 0.25};
+
+  std::ostringstream oss;
+  {
+    async_log<> logger{oss};
+    ASSERT_TRUE(logger.log(obj));
+  }
+  ASSERT_EQ(oss.str(), "LabeledValue {\n   \"id\" : 7,\n   \"value\" : 0.25\n}\n");
+}
+
+TEST(AsyncLog, DropsWhenFull)
+{
+  std::ostringstream oss;
+  async_log<> logger{oss, 4, std::chrono::microseconds{100000}};
+  ASSERT_EQ(logger.capacity(), 4UL);
+
+  my_ns::Something obj{};
+  std::size_t accepted = 0;
+  for (int i = 0; i < 64; ++i)
+  {
+    accepted += logger.log(obj);
+  }
+  ASSERT_GE(accepted, 4UL);
+  ASSERT_EQ(accepted + logger.dropped(), 64UL);
+}
+
+TEST(AsyncLog, MultipleProducers)
+{
+  static constexpr int kThreads = 4;
+  static constexpr int kPerThread = 500;
+
+  std::ostringstream oss;
+  std::size_t accepted = 0;
+  {
+    async_log<> logger{oss, 8192};
+    std::vector<std::thread> producers;
+    for (int t = 0; t < kThreads; ++t)
+    {
+      producers.emplace_back([&logger] {
+        my_ns::Something obj{};
+        for (int i = 0; i < kPerThread; ++i)
+        {
+          obj.real_number = static_cast<float>(i);
+          logger.log(obj);
+        }
+      });
+    }
+    for (auto& producer : producers)
+    {
+      producer.join();
+    }
+    logger.flush();
+    accepted = kThreads * kPerThread - logger.dropped();
+  }
+
+  const std::string text = oss.str();
+  std::size_t lines = 0;
+  for (const char c : text)
+  {
+    lines += (c == '\n') ? 1 : 0;
+  }
+  // Each formatted Something spans three lines
+  ASSERT_EQ(lines, 3 * accepted);
+}
@@ -0,0 +1,118 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/bitpack.hpp>
+
+using namespace about;
+
+namespace
+{
+
+my_ns::Fill make_fill(const int quantity, const int offset, const my_ns::MyEnum kind, const unsigned sequence)
+{
+  my_ns::Fill fill{};
+  fill.quantity = quantity;
+  fill.offset = offset;
+  fill.kind = kind;
+  fill.urgent = (sequence % 2) == 1;
+  fill.price = 100.25f + static_cast<float>(quantity);
+  fill.detail.real_number = -0.5f * static_cast<float>(offset);
+  fill.sequence = sequence;
+  return fill;
+}
+
+void expect_fill_eq(const my_ns::Fill& actual, const my_ns::Fill& expected)
+{
+  EXPECT_EQ(actual.quantity, expected.quantity);
+  EXPECT_EQ(actual.offset, expected.offset);
+  EXPECT_EQ(actual.kind, expected.kind);
+  EXPECT_EQ(actual.urgent, expected.urgent);
+  EXPECT_EQ(actual.price, expected.price);
+  EXPECT_EQ(actual.detail.real_number, expected.detail.real_number);
+  EXPECT_EQ(actual.sequence, expected.sequence);
+}
+
+}  // namespace
+
+TEST(Bitpack, BitWidths)
+{
+  // quantity, offset, kind, urgent, price, detail.real_number, sequence
+  EXPECT_EQ(bitpack::leaf_bit_widths<my_ns::Fill>(), (std::vector<std::size_t>{10, 4, 2, 1, 32, 32, 32}));
+  static_assert(bitpack::bit_width<my_ns::Fill> == 113, "");
+  static_assert(bitpack::word_count<my_ns::Fill> == 2, "");
+  static_assert(sizeof(bitpack::packed_t<my_ns::Fill>) < sizeof(my_ns::Fill), "");
+}
+
+TEST(Bitpack, RoundTrip)
+{
+  const auto fill = make_fill(1000, -8, my_ns::MyEnum::CODE, 0xFFFFFFFFU);
+  const auto packed = bitpack::encode(fill);
+  expect_fill_eq(bitpack::decode<my_ns::Fill>(packed), fill);
+
+  // Ranged members are stored as an offset from their smallest value
+  EXPECT_EQ(packed[0] & 0x3FF, 1000U);
+  EXPECT_EQ((packed[0] >> 10) & 0xF, 0U);
+  EXPECT_EQ((packed[0] >> 14) & 0x3, 3U);
+}
+
+TEST(Bitpack, RoundTripMany)
+{
+  std::vector<my_ns::Fill> fills;
+  for (int i = 0; i < 1000; ++i)
+  {
+    fills.push_back(make_fill(i, (i % 16) - 8, static_cast<my_ns::MyEnum>(i % 4), static_cast<unsigned>(i * 7919)));
+  }
+
+  const auto packed = bitpack::encode(fills);
+  ASSERT_EQ(packed.size(), fills.size());
+
+  const auto decoded = bitpack::decode<my_ns::Fill>(packed);
+  ASSERT_EQ(decoded.size(), fills.size());
+  for (std::size_t i = 0; i < fills.size(); ++i)
+  {
+    expect_fill_eq(decoded[i], fills[i]);
+  }
+}
+
+TEST(Bitpack, OutOfRange)
+{
+  EXPECT_THROW(bitpack::encode(make_fill(1001, 0, my_ns::MyEnum::THIS, 0)), std::out_of_range);
+  EXPECT_THROW(bitpack::encode(make_fill(-1, 0, my_ns::MyEnum::THIS, 0)), std::out_of_range);
+  EXPECT_THROW(bitpack::encode(make_fill(0, 8, my_ns::MyEnum::THIS, 0)), std::out_of_range);
+  EXPECT_THROW(bitpack::encode(make_fill(0, 0, static_cast<my_ns::MyEnum>(4), 0)), std::out_of_range);
+}
+
+TEST(Bitpack, FullWidthMembers)
+{
+  static_assert(bitpack::bit_width<my_ns::WirePose> == (32 * 5 + 64 + 32), "");
+
+  my_ns::WirePose pose{};
+  pose.id = -42;
+  pose.x = 1.5f;
+  pose.y = -2.5f;
+  pose.z = 1e-30f;
+  pose.stamp = 123456.789;
+  pose.scale.real_number = 3.0f;
+  pose.sequence = -1;
+
+  const auto decoded = bitpack::decode<my_ns::WirePose>(bitpack::encode(pose));
+  EXPECT_EQ(decoded.id, pose.id);
+  EXPECT_EQ(decoded.x, pose.x);
+  EXPECT_EQ(decoded.y, pose.y);
+  EXPECT_EQ(decoded.z, pose.z);
+  EXPECT_EQ(decoded.stamp, pose.stamp);
+  EXPECT_EQ(decoded.scale.real_number, pose.scale.real_number);
+  EXPECT_EQ(decoded.sequence, pose.sequence);
+}
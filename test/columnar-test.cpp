@@ -0,0 +1,168 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/columnar.hpp>
+#include <about/flatten.hpp>
+
+using namespace about;
+
+namespace
+{
+
+std::vector<my_ns::MyClass> make_records(const std::size_t n, const int offset)
+{
+  std::vector<my_ns::MyClass> records(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    const int v = static_cast<int>(i) + offset;
+    records[i].a = v;
+    records[i].b = 0.5f * v;
+    records[i].c = -2.0 * v;
+    records[i].d.a.real_number = 1.0f + v;
+    records[i].d.b.real_number = 2.0f + v;
+  }
+  return records;
+}
+
+/// Overwrites the 64-bit word at \c offset bytes past the start of the footer
+void patch_footer(const std::string& path, const std::size_t offset, const std::uint64_t value)
+{
+  std::string bytes;
+  {
+    std::ifstream ifs{path, std::ios::binary};
+    bytes.assign(std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{});
+  }
+  std::uint64_t footer_offset;
+  std::memcpy(&footer_offset, bytes.data() + bytes.size() - 16, sizeof(footer_offset));
+  std::memcpy(&bytes[footer_offset + offset], &value, sizeof(value));
+  std::ofstream{path, std::ios::binary | std::ios::trunc} << bytes;
+}
+
+}  // namespace
+
+TEST(Flatten, LeafCount)
+{
+  ASSERT_EQ(leaf_count<my_ns::Something>, 1UL);
+  ASSERT_EQ(leaf_count<my_ns::SomethingElse>, 2UL);
+  ASSERT_EQ(leaf_count<my_ns::MyClass>, 5UL);
+}
+
+TEST(Flatten, LeafNames)
+{
+  const std::vector<std::string> expected{"a", "b", "c", "d.a.real_number", "d.b.real_number"};
+  ASSERT_EQ(leaf_names<my_ns::MyClass>(), expected);
+}
+
+TEST(Flatten, LeafIndex)
+{
+  static_assert(leaf_index<my_ns::MyClass>("a"_var) == 0, "");
+  static_assert(leaf_index<my_ns::MyClass>("c"_var) == 2, "");
+  static_assert(leaf_index<my_ns::MyClass>("d.a.real_number"_var) == 3, "");
+  static_assert(leaf_index<const my_ns::MyClass&>("d.b.real_number"_var) == 4, "");
+  static_assert(!detail::LeafIndex<my_ns::MyClass, decltype("d"_var)>::found, "");
+  static_assert(!detail::LeafIndex<my_ns::MyClass, decltype("d.a"_var)>::found, "");
+  static_assert(!detail::LeafIndex<my_ns::MyClass, decltype("d.a.real_number.x"_var)>::found, "");
+  static_assert(!detail::LeafIndex<my_ns::MyClass, decltype("ab"_var)>::found, "");
+}
+
+TEST(Flatten, ForEachLeafMutable)
+{
+  my_ns::SomethingElse obj{};
+  for_each_leaf([](auto index, float& leaf) { leaf = static_cast<float>(decltype(index)::value + 1); }, obj);
+  ASSERT_EQ(obj.a.real_number, 1.0f);
+  ASSERT_EQ(obj.b.real_number, 2.0f);
+}
+
+TEST(Columnar, WriteReadProjectedColumns)
+{
+  const std::string path{::testing::TempDir() + "columnar-test.col"};
+  {
+    column_writer<my_ns::MyClass> writer{path};
+    writer.append(make_records(100, 0));
+    writer.append(make_records(50, 1000));
+    ASSERT_EQ(writer.size(), 150UL);
+  }
+
+  column_reader reader{path};
+  ASSERT_EQ(reader.size(), 150UL);
+  ASSERT_EQ(reader.chunk_count(), 2UL);
+  ASSERT_EQ(reader.column_names(), leaf_names<my_ns::MyClass>());
+
+  const auto a = reader.column<int>("a");
+  ASSERT_EQ(a.chunk_count(), 2UL);
+  ASSERT_EQ(a.size(0), 100UL);
+  ASSERT_EQ(a.size(1), 50UL);
+  ASSERT_EQ(a.min(0), 0);
+  ASSERT_EQ(a.max(0), 99);
+  ASSERT_EQ(a.min(1), 1000);
+  ASSERT_EQ(a.max(1), 1049);
+  ASSERT_EQ(a.data(1)[10], 1010);
+
+  const auto c = reader.column<double>("c");
+  ASSERT_EQ(c.min(0), -198.0);
+  ASSERT_EQ(c.max(0), 0.0);
+
+  const auto nested = reader.column<float>("d.b.real_number");
+  for (std::size_t i = 0; i < nested.size(0); ++i)
+  {
+    ASSERT_EQ(nested.data(0)[i], 2.0f + i);
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST(Columnar, InvalidColumnAccess)
+{
+  const std::string path{::testing::TempDir() + "columnar-test-invalid.col"};
+  {
+    column_writer<my_ns::MyClass> writer{path};
+    writer.append(make_records(4, 0));
+  }
+
+  column_reader reader{path};
+  ASSERT_THROW(reader.column<int>("nope"), std::out_of_range);
+  ASSERT_THROW(reader.column<float>("a"), std::invalid_argument);
+
+  std::remove(path.c_str());
+}
+
+TEST(Columnar, CorruptFooter)
+{
+  const std::string path{::testing::TempDir() + "columnar-test-corrupt.col"};
+  const auto write = [&path] {
+    column_writer<my_ns::MyClass> writer{path};
+    writer.append(make_records(4, 0));
+  };
+
+  // Column count
+  write();
+  patch_footer(path, 0, 1UL << 40);
+  ASSERT_THROW(column_reader{path}, std::runtime_error);
+
+  // Length of first column name
+  for (const std::uint64_t length : {std::uint64_t{1} << 20, std::uint64_t{1} << 40, ~std::uint64_t{0}})
+  {
+    write();
+    patch_footer(path, sizeof(std::uint64_t), length);
+    ASSERT_THROW(column_reader{path}, std::runtime_error);
+  }
+
+  std::remove(path.c_str());
+}
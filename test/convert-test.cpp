@@ -0,0 +1,82 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/convert.hpp>
+
+using namespace about;
+
+namespace
+{
+
+my_ns::WirePose make_wire_pose()
+{
+  my_ns::WirePose wire{};
+  wire.id = 7;
+  wire.x = 1.0f;
+  wire.y = 2.0f;
+  wire.z = 3.0f;
+  wire.stamp = 12.5;
+  wire.scale.real_number = 0.5f;
+  wire.sequence = 99;
+  return wire;
+}
+
+}  // namespace
+
+TEST(Convert, MatchesMembersByName)
+{
+  const auto pose = convert<my_ns::Pose>(make_wire_pose());
+  ASSERT_EQ(pose.id, 7);
+  ASSERT_EQ(pose.x, 1.0f);
+  ASSERT_EQ(pose.y, 2.0f);
+  ASSERT_EQ(pose.z, 3.0f);
+  ASSERT_EQ(pose.stamp, 12.5);
+  ASSERT_EQ(pose.scale.real_number, 0.5);
+}
+
+TEST(Convert, RoundTripSameType)
+{
+  const auto wire = make_wire_pose();
+  const auto copy = convert<my_ns::WirePose, convert_policy::exact>(wire);
+  ASSERT_EQ(copy.id, wire.id);
+  ASSERT_EQ(copy.z, wire.z);
+  ASSERT_EQ(copy.sequence, wire.sequence);
+}
+
+TEST(Convert, PartialLeavesUnmatchedMembers)
+{
+  my_ns::LabeledPose labeled{};
+  labeled.label = -1;
+  convert_into<convert_policy::partial>(make_wire_pose(), labeled);
+  ASSERT_EQ(labeled.id, 7);
+  ASSERT_EQ(labeled.y, 2.0f);
+  ASSERT_EQ(labeled.label, -1);
+}
+
+TEST(Convert, CoalescedRunMatchesMemberwiseCopy)
+{
+  using Matching = detail::MemberMatching<my_ns::Pose, my_ns::WirePose>;
+  static_assert(Matching::run_length(1) == 4, "id, x, y, z should form a single run");
+  static_assert(!Matching::continues_run(1), "id starts a run");
+  static_assert(Matching::continues_run(4), "z continues a run");
+  static_assert(!Matching::continues_run(5), "scale requires conversion");
+
+  my_ns::Pose pose{};
+  for (int i = 0; i < 16; ++i)
+  {
+    auto wire = make_wire_pose();
+    wire.id = i;
+    wire.y = static_cast<float>(-i);
+    convert_into(wire, pose);
+    ASSERT_EQ(pose.id, i);
+    ASSERT_EQ(pose.x, 1.0f);
+    ASSERT_EQ(pose.y, static_cast<float>(-i));
+  }
+}
@@ -0,0 +1,146 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <clocale>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/csv.hpp>
+
+using namespace about;
+
+namespace
+{
+
+const std::string kText{
+  "c,ignored,a,d.b.real_number,b\n"
+  "1.5,\"quoted, with \"\"delimiter\"\"\",1,2.5,3\n"
+  "-2.25,this field is long enough to cover several vector blocks,-7,0,\r\n"
+  "\n"
+  "0,,42,1e3,-0.5"};
+
+}  // namespace
+
+TEST(Csv, ReadRecords)
+{
+  const auto records = csv::read<my_ns::MyClass>(kText);
+  ASSERT_EQ(records.size(), 3UL);
+
+  ASSERT_EQ(records[0].a, 1);
+  ASSERT_EQ(records[0].b, 3.0f);
+  ASSERT_EQ(records[0].c, 1.5);
+  ASSERT_EQ(records[0].d.a.real_number, 0.0f);
+  ASSERT_EQ(records[0].d.b.real_number, 2.5f);
+
+  ASSERT_EQ(records[1].a, -7);
+  ASSERT_EQ(records[1].b, 0.0f);
+  ASSERT_EQ(records[1].c, -2.25);
+
+  ASSERT_EQ(records[2].a, 42);
+  ASSERT_EQ(records[2].b, -0.5f);
+  ASSERT_EQ(records[2].d.b.real_number, 1000.0f);
+}
+
+TEST(Csv, ReadColumns)
+{
+  const auto columns = csv::read_columns<my_ns::MyClass>(kText.data(), kText.size());
+  ASSERT_EQ(std::get<0>(columns), (std::vector<int>{1, -7, 42}));
+  ASSERT_EQ(std::get<2>(columns), (std::vector<double>{1.5, -2.25, 0.0}));
+  ASSERT_EQ(std::get<3>(columns).size(), 3UL);
+}
+
+TEST(Csv, CustomDelimiter)
+{
+  const auto records = csv::read<my_ns::Something>(std::string{"real_number;other\n0.25;x\n"}, ';');
+  ASSERT_EQ(records.size(), 1UL);
+  ASSERT_EQ(records[0].real_number, 0.25f);
+}
+
+TEST(Csv, InvalidValue)
+{
+  ASSERT_THROW(csv::read<my_ns::MyClass>(std::string{"a\n12x\n"}), std::runtime_error);
+  ASSERT_THROW(csv::read<my_ns::MyClass>(std::string{"a\n99999999999\n"}), std::runtime_error);
+  ASSERT_THROW(csv::read<my_ns::MyClass>(std::string{"a,c\n1,\"open\n"}), std::runtime_error);
+}
+
+TEST(Csv, NonDecimalFloat)
+{
+  ASSERT_THROW(csv::read<my_ns::MyClass>(std::string{"c\ninf\n"}), std::runtime_error);
+  ASSERT_THROW(csv::read<my_ns::MyClass>(std::string{"c\nnan\n"}), std::runtime_error);
+  ASSERT_THROW(csv::read<my_ns::MyClass>(std::string{"c\n0x1p3\n"}), std::runtime_error);
+  ASSERT_THROW(csv::read<my_ns::MyClass>(std::string{"c\n 1.5\n"}), std::runtime_error);
+  ASSERT_THROW(csv::read<my_ns::MyClass>(std::string{"c\n.\n"}), std::runtime_error);
+  ASSERT_THROW(csv::read<my_ns::MyClass>(std::string{"c\n1e\n"}), std::runtime_error);
+
+  const auto records = csv::read<my_ns::MyClass>(std::string{"c\n.5\n-2.\n+1E-2\n"});
+  ASSERT_EQ(records.size(), 3UL);
+  ASSERT_EQ(records[0].c, 0.5);
+  ASSERT_EQ(records[1].c, -2.0);
+  ASSERT_EQ(records[2].c, 0.01);
+}
+
+TEST(Csv, FloatIgnoresGlobalLocale)
+{
+  // Only meaningful where a decimal-comma locale is installed
+  const std::string previous{std::setlocale(LC_NUMERIC, nullptr)};
+  if (std::setlocale(LC_NUMERIC, "de_DE.UTF-8") == nullptr)
+  {
+    return;
+  }
+  const auto records = csv::read<my_ns::MyClass>(std::string{"c\n1.5\n"});
+  std::setlocale(LC_NUMERIC, previous.c_str());
+  ASSERT_EQ(records.size(), 1UL);
+  ASSERT_EQ(records[0].c, 1.5);
+}
+
+TEST(Csv, CharacterAfterClosingQuote)
+{
+  ASSERT_THROW(csv::read<my_ns::MyClass>(std::string{"a,c\n\"1\"x,2\n"}), std::runtime_error);
+  ASSERT_THROW(csv::read<my_ns::MyClass>(std::string{"a,c\n1,\"2\" \n"}), std::runtime_error);
+  ASSERT_THROW(csv::read<my_ns::MyClass>(std::string{"a,c\n1,\"2\"\r"}), std::runtime_error);
+
+  const auto records = csv::read<my_ns::MyClass>(std::string{"a,c\n\"1\",\"2\"\r\n\"3\",\"4\""});
+  ASSERT_EQ(records.size(), 2UL);
+  ASSERT_EQ(records[0].a, 1);
+  ASSERT_EQ(records[0].c, 2.0);
+  ASSERT_EQ(records[1].a, 3);
+  ASSERT_EQ(records[1].c, 4.0);
+}
+
+TEST(Csv, StreamingReader)
+{
+  std::ostringstream oss;
+  oss << "a,\"b\",c\n";
+  for (int i = 0; i < 1000; ++i)
+  {
+    oss << i << ",\"" << (0.5f * i) << "\"," << -i << '\n';
+  }
+
+  std::istringstream iss{oss.str()};
+  csv::reader<my_ns::MyClass> reader{iss, ',', 64};
+
+  std::vector<my_ns::MyClass> records;
+  std::size_t batches = 0;
+  while (reader.read(records, 128) > 0)
+  {
+    ++batches;
+  }
+
+  ASSERT_EQ(batches, 8UL);
+  ASSERT_EQ(records.size(), 1000UL);
+  for (int i = 0; i < 1000; ++i)
+  {
+    ASSERT_EQ(records[i].a, i);
+    ASSERT_EQ(records[i].b, 0.5f * i);
+    ASSERT_EQ(records[i].c, -i);
+  }
+}
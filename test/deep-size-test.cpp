@@ -0,0 +1,191 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <string>
+#include <utility>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/deep_size.hpp>
+
+/// Stands in for a user container which is not reflected
+struct Buffer
+{
+  std::size_t capacity;
+};
+
+struct CacheEntry
+{
+  std::string key;
+  std::vector<my_ns::Something> values;
+  std::vector<std::string> tags;
+  Buffer buffer;
+  int hits;
+};
+
+namespace about
+{
+
+template <> struct deep_size_traits<::Buffer>
+{
+  static std::size_t heap_bytes(const ::Buffer& buffer) { return buffer.capacity; }
+};
+
+namespace detail
+{
+
+template <> struct ClassMetaInfo<::CacheEntry>
+{
+  static constexpr const char* name = "CacheEntry";
+  static constexpr const char* absolute_name = "CacheEntry";
+
+  struct MemberInfo__CacheEntry__key
+  {
+    using type = std::string;
+    static constexpr const char* name = "key";
+  };
+
+  struct MemberInfo__CacheEntry__values
+  {
+    using type = std::vector<my_ns::Something>;
+    static constexpr const char* name = "values";
+  };
+
+  struct MemberInfo__CacheEntry__tags
+  {
+    using type = std::vector<std::string>;
+    static constexpr const char* name = "tags";
+  };
+
+  struct MemberInfo__CacheEntry__buffer
+  {
+    using type = ::Buffer;
+    static constexpr const char* name = "buffer";
+  };
+
+  struct MemberInfo__CacheEntry__hits
+  {
+    using type = int;
+    static constexpr const char* name = "hits";
+  };
+
+  using public_var_info = std::tuple<
+    MemberInfo__CacheEntry__key,
+    MemberInfo__CacheEntry__values,
+    MemberInfo__CacheEntry__tags,
+    MemberInfo__CacheEntry__buffer,
+    MemberInfo__CacheEntry__hits>;
+
+  static constexpr decltype(auto) public_vars(::CacheEntry& v)
+  {
+    return std::tie(v.key, v.values, v.tags, v.buffer, v.hits);
+  }
+
+  static constexpr decltype(auto) public_vars(const ::CacheEntry& v)
+  {
+    return std::tie(v.key, v.values, v.tags, v.buffer, v.hits);
+  }
+};
+
+}  // namespace detail
+}  // namespace about
+
+using namespace about;
+
+namespace
+{
+
+CacheEntry make_entry()
+{
+  CacheEntry entry{};
+  entry.key = std::string(100, 'k');
+  entry.values.reserve(10);
+  entry.values.resize(3);
+  entry.tags = {std::string(50, 't'), "x"};
+  entry.tags.shrink_to_fit();
+  entry.buffer.capacity = 64;
+  entry.hits = 1;
+  return entry;
+}
+
+std::size_t string_heap(const std::string& s) { return deep_size_traits<std::string>::heap_bytes(s); }
+
+}  // namespace
+
+TEST(DeepSize, ScalarsAndPlainReflectedTypes)
+{
+  EXPECT_EQ(deep_size(1.0), sizeof(double));
+
+  my_ns::MyClass obj{};
+  EXPECT_EQ(deep_size(obj), sizeof(my_ns::MyClass));
+}
+
+TEST(DeepSize, ShortStringOwnsNoHeap)
+{
+  const std::string s{"x"};
+  EXPECT_EQ(deep_size(s), sizeof(std::string));
+}
+
+TEST(DeepSize, LongStringOwnsCapacity)
+{
+  const std::string s(100, 'k');
+  EXPECT_EQ(deep_size(s), sizeof(std::string) + s.capacity() + 1);
+}
+
+TEST(DeepSize, VectorOwnsCapacityAndElementHeap)
+{
+  std::vector<std::string> v{std::string(100, 'a'), "b"};
+  v.reserve(8);
+  EXPECT_EQ(deep_size(v), sizeof(v) + 8 * sizeof(std::string) + v[0].capacity() + 1);
+}
+
+TEST(DeepSize, NestedMembersAndCustomization)
+{
+  const auto entry = make_entry();
+
+  const std::size_t expected = sizeof(CacheEntry) + string_heap(entry.key) +
+    entry.values.capacity() * sizeof(my_ns::Something) + entry.tags.capacity() * sizeof(std::string) +
+    string_heap(entry.tags[0]) + string_heap(entry.tags[1]) + 64;
+  EXPECT_EQ(deep_size(entry), expected);
+}
+
+TEST(DeepSize, Range)
+{
+  const std::vector<CacheEntry> entries(5, make_entry());
+  EXPECT_EQ(deep_size(entries.begin(), entries.end()), 5 * deep_size(entries.front()));
+}
+
+TEST(DeepSize, Breakdown)
+{
+  const std::vector<CacheEntry> entries(4, make_entry());
+
+  deep_size_breakdown<CacheEntry> breakdown;
+  breakdown.add(entries.begin(), entries.end());
+
+  ASSERT_EQ(breakdown.size, 5UL);
+  EXPECT_EQ(breakdown.names()[0], "key");
+  EXPECT_EQ(breakdown.count(), 4UL);
+  EXPECT_EQ(breakdown.get("key"_var), 4 * (sizeof(std::string) + string_heap(entries[0].key)));
+  EXPECT_EQ(breakdown.at("buffer"), 4 * (sizeof(Buffer) + 64));
+  EXPECT_EQ(breakdown[4], 4 * sizeof(int));
+  EXPECT_EQ(breakdown.total(), deep_size(entries.begin(), entries.end()));
+  EXPECT_THROW(breakdown.at("nope"), std::out_of_range);
+}
+
+TEST(DeepSize, BreakdownOfNestedLeaves)
+{
+  deep_size_breakdown<my_ns::MyClass> breakdown;
+  breakdown.add(my_ns::MyClass{});
+
+  EXPECT_EQ(breakdown.at("d.a.real_number"), sizeof(float));
+  EXPECT_EQ(breakdown.get("d.b.real_number"_var), sizeof(float));
+  EXPECT_EQ(breakdown.unaccounted(), sizeof(my_ns::MyClass) - (sizeof(int) + sizeof(double) + 3 * sizeof(float)));
+  EXPECT_EQ(breakdown.total(), sizeof(my_ns::MyClass));
+}
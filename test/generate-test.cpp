@@ -0,0 +1,217 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/generate.hpp>
+
+struct Order
+{
+  std::string symbol;
+  std::vector<my_ns::Something> fills;
+  bool urgent;
+};
+
+namespace about
+{
+namespace detail
+{
+
+template <> struct ClassMetaInfo<::Order>
+{
+  static constexpr const char* name = "Order";
+  static constexpr const char* absolute_name = "Order";
+
+  struct MemberInfo__Order__symbol
+  {
+    using type = std::string;
+    static constexpr const char* name = "symbol";
+  };
+
+  struct MemberInfo__Order__fills
+  {
+    using type = std::vector<my_ns::Something>;
+    static constexpr const char* name = "fills";
+  };
+
+  struct MemberInfo__Order__urgent
+  {
+    using type = bool;
+    static constexpr const char* name = "urgent";
+  };
+
+  using public_var_info = std::tuple<MemberInfo__Order__symbol, MemberInfo__Order__fills, MemberInfo__Order__urgent>;
+
+  static constexpr decltype(auto) public_vars(::Order& v) { return std::tie(v.symbol, v.fills, v.urgent); }
+
+  static constexpr decltype(auto) public_vars(const ::Order& v) { return std::tie(v.symbol, v.fills, v.urgent); }
+};
+
+}  // namespace detail
+}  // namespace about
+
+using namespace about;
+
+TEST(Generate, DefaultRanges)
+{
+  std::mt19937_64 rng{1};
+  for (const auto& obj : generate<my_ns::MyClass>(rng, 100))
+  {
+    EXPECT_GE(obj.a, -1000);
+    EXPECT_LE(obj.a, 1000);
+    EXPECT_GE(obj.c, 0.0);
+    EXPECT_LE(obj.c, 1.0);
+    EXPECT_GE(obj.d.b.real_number, 0.0f);
+    EXPECT_LE(obj.d.b.real_number, 1.0f);
+  }
+}
+
+TEST(Generate, EnumMembers)
+{
+  std::mt19937_64 rng{5};
+  std::vector<int> counts(4, 0);
+  for (const auto& quote : generate<my_ns::Quote>(rng, 1000))
+  {
+    const int value = static_cast<int>(quote.kind);
+    ASSERT_GE(value, static_cast<int>(my_ns::MyEnum::THIS));
+    ASSERT_LE(value, static_cast<int>(my_ns::MyEnum::CODE));
+    ++counts[value];
+  }
+  for (const int count : counts)
+  {
+    EXPECT_GT(count, 0);
+  }
+
+  generate_config config;
+  config.set("kind"_var, field_distribution::constant(2));
+  EXPECT_EQ(generate<my_ns::Quote>(rng, config).kind, my_ns::MyEnum::A);
+}
+
+TEST(Generate, SaturatesAtIntegerLimits)
+{
+  using limits = std::numeric_limits<long long>;
+  std::mt19937_64 rng{17};
+  EXPECT_EQ(detail::sample_integral<long long>(rng, field_distribution::constant(1e30)), limits::max());
+  EXPECT_EQ(detail::sample_integral<long long>(rng, field_distribution::constant(-1e30)), limits::lowest());
+  EXPECT_EQ(detail::sample_integral<unsigned long long>(rng, field_distribution::constant(1e30)), ~0ULL);
+  EXPECT_EQ(detail::sample_integral<unsigned long long>(rng, field_distribution::constant(-1.0)), 0ULL);
+  EXPECT_EQ(detail::sample_integral<signed char>(rng, field_distribution::normal(1e6, 1.0)), 127);
+
+  const auto full = field_distribution::uniform(static_cast<double>(limits::lowest()), static_cast<double>(limits::max()));
+  for (int i = 0; i < 100; ++i)
+  {
+    detail::sample_integral<long long>(rng, full);
+  }
+}
+
+TEST(Generate, SameSeedSameValues)
+{
+  std::mt19937_64 lhs_rng{7};
+  std::mt19937_64 rhs_rng{7};
+  const auto lhs = generate<my_ns::MyClass>(lhs_rng);
+  const auto rhs = generate<my_ns::MyClass>(rhs_rng);
+  EXPECT_EQ(lhs.a, rhs.a);
+  EXPECT_EQ(lhs.b, rhs.b);
+  EXPECT_EQ(lhs.c, rhs.c);
+  EXPECT_EQ(lhs.d.a.real_number, rhs.d.a.real_number);
+}
+
+TEST(Generate, PerFieldDistributions)
+{
+  generate_config config;
+  config.set("a"_var, field_distribution::constant(5))
+    .set("real_number"_var, field_distribution::uniform(10.0, 20.0))
+    .set("d.b.real_number", field_distribution::constant(-1.0))
+    .integral(field_distribution::uniform(0, 0));
+
+  std::mt19937_64 rng{3};
+  const generator<my_ns::MyClass> g{config};
+  for (int i = 0; i < 100; ++i)
+  {
+    const auto obj = g(rng);
+    EXPECT_EQ(obj.a, 5);
+    EXPECT_GE(obj.d.a.real_number, 10.0f);
+    EXPECT_LE(obj.d.a.real_number, 20.0f);
+    EXPECT_EQ(obj.d.b.real_number, -1.0f);
+  }
+}
+
+TEST(Generate, StringsAndContainers)
+{
+  generate_config config;
+  config.string_length(3, 5).set("fills"_var, field_distribution::constant(4)).floating(field_distribution::constant(2.5));
+
+  std::mt19937_64 rng{11};
+  for (const auto& order : generate<Order>(rng, 50, config))
+  {
+    EXPECT_GE(order.symbol.size(), 3UL);
+    EXPECT_LE(order.symbol.size(), 5UL);
+    ASSERT_EQ(order.fills.size(), 4UL);
+    for (const auto& fill : order.fills)
+    {
+      EXPECT_EQ(fill.real_number, 2.5f);
+    }
+  }
+}
+
+TEST(Generate, ContainerElementsByPrefixedName)
+{
+  generate_config config;
+  config.set("fills.real_number", field_distribution::constant(-3.0));
+
+  std::mt19937_64 rng{13};
+  const auto order = generate<Order>(rng, config);
+  for (const auto& fill : order.fills)
+  {
+    EXPECT_EQ(fill.real_number, -3.0f);
+  }
+}
+
+TEST(Generate, FuzzOneInput)
+{
+  const std::vector<std::uint8_t> data{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  std::vector<Order> seen;
+  const auto record = [&seen](const Order& order) { seen.push_back(order); };
+
+  EXPECT_EQ(fuzz_one_input<Order>(data.data(), data.size(), record), 0);
+  EXPECT_EQ(fuzz_one_input<Order>(data.data(), data.size(), record), 0);
+  EXPECT_EQ(fuzz_one_input<Order>(nullptr, 0, record), 0);
+
+  ASSERT_EQ(seen.size(), 3UL);
+  EXPECT_EQ(seen[0].symbol, seen[1].symbol);
+  EXPECT_EQ(seen[0].fills.size(), seen[1].fills.size());
+  EXPECT_EQ(seen[0].urgent, seen[1].urgent);
+}
+
+TEST(Generate, FuzzOneInputWithGenerator)
+{
+  const std::vector<std::uint8_t> data{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  generate_config short_config;
+  short_config.string_length(1, 1);
+  generate_config long_config;
+  long_config.string_length(8, 8);
+  const generator<Order> short_generator{short_config};
+  const generator<Order> long_generator{long_config};
+
+  std::size_t length = 0;
+  const auto record = [&length](const Order& order) { length = order.symbol.size(); };
+
+  EXPECT_EQ(fuzz_one_input(data.data(), data.size(), short_generator, record), 0);
+  EXPECT_EQ(length, 1UL);
+  EXPECT_EQ(fuzz_one_input(data.data(), data.size(), long_generator, record), 0);
+  EXPECT_EQ(length, 8UL);
+}
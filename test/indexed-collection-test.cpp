@@ -0,0 +1,195 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/indexed_collection.hpp>
+
+using namespace about;
+
+namespace
+{
+
+using PoseCollection = indexed_collection<
+  my_ns::WirePose,
+  hashed<decltype("id"_var)>,
+  ordered<decltype("stamp"_var)>,
+  hashed<decltype("sequence"_var)>>;
+
+my_ns::WirePose make_pose(const int id, const double stamp, const int sequence)
+{
+  my_ns::WirePose pose{};
+  pose.id = id;
+  pose.stamp = stamp;
+  pose.sequence = sequence;
+  return pose;
+}
+
+std::vector<int> ids_in(const PoseCollection& poses, const double first, const double last)
+{
+  std::vector<int> ids;
+  poses.for_each_in("stamp"_var, first, last, [&ids](auto id, const my_ns::WirePose& pose) { ids.push_back(pose.id); });
+  return ids;
+}
+
+}  // namespace
+
+TEST(IndexedCollection, InsertAndFind)
+{
+  PoseCollection poses;
+  EXPECT_TRUE(poses.empty());
+
+  const auto a = poses.insert(make_pose(1, 10.0, 100));
+  const auto b = poses.insert(make_pose(2, 5.0, 200));
+  EXPECT_TRUE(a.second);
+  EXPECT_TRUE(b.second);
+  EXPECT_EQ(poses.size(), 2UL);
+
+  ASSERT_NE(poses.find("id"_var, 2), nullptr);
+  EXPECT_EQ(poses.find("id"_var, 2)->stamp, 5.0);
+  EXPECT_EQ(poses.find_id("sequence"_var, 100), a.first);
+  EXPECT_EQ(poses.find("id"_var, 3), nullptr);
+  EXPECT_EQ(poses.find_id("sequence"_var, 300), PoseCollection::npos);
+}
+
+TEST(IndexedCollection, RejectsRepeatedUniqueKey)
+{
+  PoseCollection poses;
+  const auto a = poses.insert(make_pose(1, 10.0, 100));
+
+  const auto same_id = poses.insert(make_pose(1, 20.0, 101));
+  EXPECT_FALSE(same_id.second);
+  EXPECT_EQ(same_id.first, a.first);
+
+  const auto same_sequence = poses.insert(make_pose(2, 20.0, 100));
+  EXPECT_FALSE(same_sequence.second);
+  EXPECT_EQ(poses.size(), 1UL);
+
+  // Ordered keys may repeat
+  EXPECT_TRUE(poses.insert(make_pose(3, 10.0, 103)).second);
+}
+
+TEST(IndexedCollection, OrderedRange)
+{
+  PoseCollection poses;
+  poses.insert(make_pose(1, 3.0, 1));
+  poses.insert(make_pose(2, 1.0, 2));
+  poses.insert(make_pose(3, 2.0, 3));
+  poses.insert(make_pose(4, 2.0, 4));
+  poses.insert(make_pose(5, 4.0, 5));
+
+  EXPECT_EQ(ids_in(poses, 2.0, 4.0), (std::vector<int>{3, 4, 1}));
+  EXPECT_EQ(ids_in(poses, 0.0, 10.0), (std::vector<int>{2, 3, 4, 1, 5}));
+  EXPECT_TRUE(ids_in(poses, 5.0, 6.0).empty());
+
+  std::vector<double> stamps;
+  poses.for_each_ordered("stamp"_var, [&stamps](auto id, const my_ns::WirePose& pose) { stamps.push_back(pose.stamp); });
+  EXPECT_EQ(stamps, (std::vector<double>{1.0, 2.0, 2.0, 3.0, 4.0}));
+}
+
+TEST(IndexedCollection, EraseRemovesFromAllIndexesAndReusesSlot)
+{
+  PoseCollection poses;
+  const auto a = poses.insert(make_pose(1, 1.0, 10));
+  poses.insert(make_pose(2, 2.0, 20));
+
+  EXPECT_TRUE(poses.erase(a.first));
+  EXPECT_FALSE(poses.erase(a.first));
+  EXPECT_FALSE(poses.contains(a.first));
+  EXPECT_THROW(poses.at(a.first), std::out_of_range);
+  EXPECT_EQ(poses.find("id"_var, 1), nullptr);
+  EXPECT_EQ(poses.find("sequence"_var, 10), nullptr);
+  EXPECT_EQ(ids_in(poses, 0.0, 10.0), (std::vector<int>{2}));
+
+  const auto c = poses.insert(make_pose(1, 3.0, 10));
+  EXPECT_TRUE(c.second);
+  EXPECT_EQ(c.first, a.first);
+  EXPECT_EQ(poses.size(), 2UL);
+}
+
+TEST(IndexedCollection, ModifyReindexes)
+{
+  PoseCollection poses;
+  const auto a = poses.insert(make_pose(1, 1.0, 10));
+  poses.insert(make_pose(2, 2.0, 20));
+
+  EXPECT_TRUE(poses.modify(a.first, [](my_ns::WirePose& pose) {
+    pose.id = 7;
+    pose.stamp = 5.0;
+  }));
+  EXPECT_EQ(poses.find("id"_var, 1), nullptr);
+  EXPECT_EQ(poses.find_id("id"_var, 7), a.first);
+  EXPECT_EQ(ids_in(poses, 0.0, 10.0), (std::vector<int>{2, 7}));
+
+  EXPECT_FALSE(poses.modify(a.first, [](my_ns::WirePose& pose) { pose.sequence = 20; }));
+  EXPECT_EQ(poses.at(a.first).sequence, 10);
+}
+
+TEST(IndexedCollection, MatchesSeparateMaps)
+{
+  PoseCollection poses;
+  std::unordered_map<int, PoseCollection::id_type> by_id;
+  std::multimap<double, int> by_stamp;
+
+  std::mt19937 rng{3};
+  std::uniform_int_distribution<int> key{0, 3000};
+  for (int step = 0; step < 20000; ++step)
+  {
+    const int id = key(rng);
+    const auto itr = by_id.find(id);
+    if (itr == by_id.end())
+    {
+      const double stamp = static_cast<double>(key(rng) % 500);
+      const auto inserted = poses.insert(make_pose(id, stamp, id + 100000));
+      ASSERT_TRUE(inserted.second);
+      by_id.emplace(id, inserted.first);
+      by_stamp.emplace(stamp, id);
+    }
+    else
+    {
+      const double stamp = poses[itr->second].stamp;
+      ASSERT_TRUE(poses.erase(itr->second));
+      by_id.erase(itr);
+      auto range = by_stamp.equal_range(stamp);
+      while (range.first->second != id)
+      {
+        ++range.first;
+      }
+      by_stamp.erase(range.first);
+    }
+  }
+
+  ASSERT_EQ(poses.size(), by_id.size());
+  for (int id = 0; id <= 3000; ++id)
+  {
+    const auto itr = by_id.find(id);
+    EXPECT_EQ(poses.find_id("id"_var, id), (itr == by_id.end()) ? PoseCollection::npos : itr->second);
+    EXPECT_EQ(poses.find_id("sequence"_var, id + 100000), poses.find_id("id"_var, id));
+  }
+
+  std::vector<double> expected;
+  for (const auto& entry : by_stamp)
+  {
+    if (entry.first >= 100.0 && entry.first < 300.0)
+    {
+      expected.push_back(entry.first);
+    }
+  }
+  std::vector<double> actual;
+  poses.for_each_in(
+    "stamp"_var, 100.0, 300.0, [&actual](auto id, const my_ns::WirePose& pose) { actual.push_back(pose.stamp); });
+  EXPECT_EQ(actual, expected);
+}
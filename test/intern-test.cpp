@@ -0,0 +1,170 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <limits>
+#include <set>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/intern.hpp>
+
+using namespace about;
+
+namespace
+{
+
+my_ns::WirePose make_pose(const int i)
+{
+  my_ns::WirePose pose{};
+  pose.id = i;
+  pose.x = static_cast<float>(i) * 0.5f;
+  pose.y = -1.0f;
+  pose.z = 2.0f;
+  pose.stamp = static_cast<double>(i);
+  pose.scale.real_number = 1.0f;
+  pose.sequence = i;
+  return pose;
+}
+
+}  // namespace
+
+TEST(Intern, HashAndEqualMembers)
+{
+  const auto a = make_pose(1);
+  auto b = make_pose(1);
+  EXPECT_TRUE(equal_members(a, b));
+  EXPECT_EQ(hash_members(a), hash_members(b));
+
+  b.scale.real_number = 3.0f;
+  EXPECT_FALSE(equal_members(a, b));
+  EXPECT_NE(hash_members(a), hash_members(b));
+}
+
+TEST(Intern, DeduplicatesEqualValues)
+{
+  intern_pool<my_ns::WirePose> pool;
+
+  const auto h0 = pool.intern(make_pose(0));
+  const auto h1 = pool.intern(make_pose(1));
+  const auto h0_again = pool.intern(make_pose(0));
+
+  EXPECT_EQ(h0, h0_again);
+  EXPECT_NE(h0, h1);
+  EXPECT_EQ(pool.size(), 2UL);
+  EXPECT_TRUE(equal_members(pool[h0], make_pose(0)));
+  EXPECT_TRUE(equal_members(pool.get(h1), make_pose(1)));
+}
+
+TEST(Intern, FloatingLeaves)
+{
+  auto nan_pose = make_pose(1);
+  nan_pose.stamp = std::numeric_limits<double>::quiet_NaN();
+  nan_pose.scale.real_number = std::numeric_limits<float>::quiet_NaN();
+  EXPECT_TRUE(equal_members(nan_pose, nan_pose));
+  EXPECT_FALSE(equal_members(nan_pose, make_pose(1)));
+
+  auto negative_zero_pose = make_pose(0);
+  negative_zero_pose.x = -0.0f;
+  EXPECT_TRUE(equal_members(negative_zero_pose, make_pose(0)));
+  EXPECT_EQ(hash_members(negative_zero_pose), hash_members(make_pose(0)));
+
+  intern_pool<my_ns::WirePose> pool;
+  const auto h = pool.intern(nan_pose);
+  for (int i = 0; i < 100; ++i)
+  {
+    EXPECT_EQ(pool.intern(nan_pose), h);
+  }
+  EXPECT_EQ(pool.intern(negative_zero_pose), pool.intern(make_pose(0)));
+  EXPECT_EQ(pool.size(), 2UL);
+}
+
+TEST(Intern, HandlesAndAddressesAreStableAcrossGrowth)
+{
+  intern_pool<my_ns::WirePose> pool;
+
+  std::vector<intern_pool<my_ns::WirePose>::handle> handles;
+  std::vector<const my_ns::WirePose*> addresses;
+  for (int i = 0; i < 20000; ++i)
+  {
+    handles.push_back(pool.intern(make_pose(i)));
+    addresses.push_back(&pool.get(handles.back()));
+  }
+  ASSERT_EQ(pool.size(), 20000UL);
+
+  for (int i = 0; i < 20000; ++i)
+  {
+    EXPECT_EQ(pool.intern(make_pose(i)), handles[i]);
+    EXPECT_EQ(&pool.get(handles[i]), addresses[i]);
+    EXPECT_EQ(pool.get(handles[i]).id, i);
+  }
+}
+
+TEST(Intern, ConcurrentInsertion)
+{
+  static constexpr int kThreads = 4;
+  static constexpr int kDistinct = 5000;
+
+  intern_pool<my_ns::WirePose> pool;
+  std::vector<std::vector<intern_pool<my_ns::WirePose>::handle>> handles(kThreads);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t)
+  {
+    threads.emplace_back([&pool, &handles, t] {
+      for (int i = 0; i < kDistinct; ++i)
+      {
+        handles[t].push_back(pool.intern(make_pose((i * (t + 1)) % kDistinct)));
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  EXPECT_EQ(pool.size(), static_cast<std::size_t>(kDistinct));
+
+  std::set<std::uint32_t> unique;
+  for (int t = 0; t < kThreads; ++t)
+  {
+    for (int i = 0; i < kDistinct; ++i)
+    {
+      const auto h = handles[t][i];
+      unique.insert(h.value());
+      EXPECT_EQ(pool.get(h).id, (i * (t + 1)) % kDistinct);
+    }
+  }
+  EXPECT_EQ(unique.size(), static_cast<std::size_t>(kDistinct));
+}
+
+TEST(Intern, Stats)
+{
+  intern_pool<my_ns::WirePose> pool;
+
+  for (int repeat = 0; repeat < 100; ++repeat)
+  {
+    for (int i = 0; i < 100; ++i)
+    {
+      pool.intern(make_pose(i));
+    }
+  }
+
+  const auto stats = pool.stats();
+  EXPECT_EQ(stats.interned, 10000UL);
+  EXPECT_EQ(stats.distinct, 100UL);
+  EXPECT_EQ(stats.copied_bytes, 10000UL * sizeof(my_ns::WirePose));
+  EXPECT_GE(stats.pool_bytes, 100UL * sizeof(my_ns::WirePose));
+  EXPECT_EQ(
+    stats.saved_bytes(),
+    static_cast<std::ptrdiff_t>(stats.copied_bytes) -
+      static_cast<std::ptrdiff_t>(stats.pool_bytes + 10000UL * sizeof(std::uint32_t)));
+  EXPECT_GT(stats.saved_bytes(), 0);
+}
@@ -3,6 +3,10 @@
  * @author Brian Cairl
  */
 
+// C++ Standard Library
+#include <limits>
+#include <type_traits>
+
 // GTest
 #include <gtest/gtest.h>
 
@@ -12,6 +16,18 @@
 
 using namespace about;
 
+namespace
+{
+
+template <typename EnumT, typename Enable = void> struct HasEnumRange : std::false_type
+{};
+
+template <typename EnumT>
+struct HasEnumRange<EnumT, decltype(void(detail::ClassMetaInfo<EnumT>::min_value))> : std::true_type
+{};
+
+}  // namespace
+
 TEST(MetaGeneration, MethodExists) { ASSERT_TRUE(has<my_ns::MyClass>("my_method"_method)); }
 
 TEST(MetaGeneration, MethodDoesNotExist) { ASSERT_FALSE(has<my_ns::MyClass>("not_my_method"_method)); }
@@ -48,4 +64,17 @@ TEST(MetaGeneration, AbsoluteNameOfEnum) { ASSERT_EQ("my_ns::MyEnum", absolute_n
 TEST(MetaGeneration, AbsoluteNameOfNestedEnum)
 {
   ASSERT_EQ("my_ns::MyClass::NestedEnum", absolute_nameof<my_ns::MyClass::NestedEnum>);
-}
\ No newline at end of file
+}
+
+TEST(MetaGeneration, EnumRange)
+{
+  static_assert(detail::ClassMetaInfo<my_ns::MyEnum>::min_value == 0, "");
+  static_assert(detail::ClassMetaInfo<my_ns::MyEnum>::max_value == 3, "");
+  static_assert(detail::ClassMetaInfo<my_ns::Lowest>::min_value == std::numeric_limits<long long>::min(), "");
+  static_assert(detail::ClassMetaInfo<my_ns::Lowest>::max_value == 0, "");
+
+  // Enumerators which do not fit long long have no range
+  static_assert(HasEnumRange<my_ns::Lowest>::value, "");
+  static_assert(!HasEnumRange<my_ns::Sentinel>::value, "");
+  static_assert(detail::ClassMetaInfo<my_ns::Sentinel>::value_count == 2, "");
+}
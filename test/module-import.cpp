@@ -0,0 +1,13 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+import test.test_classes_with_reflection;
+
+int main()
+{
+  my_ns::MyClass obj{};
+  obj.d.b.real_number = 2.0f;
+  return (about::nameof<my_ns::MyClass>[0] == 'M' && obj.d.b.real_number == 2.0f) ? 0 : 1;
+}
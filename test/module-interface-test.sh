@@ -0,0 +1,27 @@
+#!/bin/bash
+#
+# Compiles the generated C++20 module interface unit for :test_classes_with_reflection, then a translation unit
+# which imports it. Passes without checking anything if the compiler has no named module support.
+#
+set -euo pipefail
+
+CXX="${CXX:-g++}"
+RUNFILES="${PWD}"
+WORK="${TEST_TMPDIR:-$(mktemp -d)}"
+
+if ! echo "export module probe;" | "${CXX}" -std=c++20 -fmodules-ts -x c++ -c - -o /dev/null 2> /dev/null
+then
+  echo "${CXX} does not support -std=c++20 -fmodules-ts; skipping"
+  exit 0
+fi
+
+# Lay out About headers as <about/...>, as //:about and //:utility do
+mkdir -p "${WORK}/include/about"
+ln -sf "${RUNFILES}"/include/*.hpp "${RUNFILES}"/include/utility/*.hpp "${WORK}/include/about/"
+
+cd "${WORK}"
+"${CXX}" -std=c++20 -fmodules-ts -I"${WORK}/include" -I"${RUNFILES}" \
+  -x c++ -c "${RUNFILES}/test/test_classes_with_reflection.cppm" -o module.o
+"${CXX}" -std=c++20 -fmodules-ts -I"${WORK}/include" -I"${RUNFILES}" \
+  -x c++ "${RUNFILES}/test/module-import.cpp" -x none module.o -o module-import
+./module-import
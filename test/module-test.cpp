@@ -0,0 +1,34 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <sstream>
+#include <tuple>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.module.hpp"
+
+using namespace about;
+
+TEST(ModuleHeaderUnit, Reflection)
+{
+  ASSERT_EQ("MyClass", nameof<my_ns::MyClass>);
+  ASSERT_TRUE(has<my_ns::MyClass>("my_method"_method));
+
+  my_ns::MyClass obj{};
+  obj.a = 3;
+  ASSERT_EQ(std::get<0>(get_public_vars(obj)), 3);
+}
+
+TEST(ModuleHeaderUnit, Formatting)
+{
+  std::ostringstream oss;
+  oss << fmt<0>(my_ns::Something{}) << ' ' << my_ns::MyEnum::IS;
+  ASSERT_NE(oss.str().find("real_number"), std::string::npos);
+  ASSERT_NE(oss.str().find("MyEnum::IS"), std::string::npos);
+}
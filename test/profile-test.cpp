@@ -0,0 +1,127 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/deep_size.hpp>
+#include <about/flatten.hpp>
+#include <about/fmt.hpp>
+#include <about/var.hpp>
+
+using namespace about;
+
+namespace
+{
+
+detail::FieldProfile find_profile(const std::string& type_name)
+{
+  for (auto& profile : detail::FieldProfileRegistry::instance().snapshot())
+  {
+    if (profile.type_name == type_name)
+    {
+      return profile;
+    }
+  }
+  return detail::FieldProfile{};
+}
+
+}  // namespace
+
+TEST(Profile, CountsMemberAccesses)
+{
+  std::vector<my_ns::WirePose> poses(10);
+  for (auto& pose : poses)
+  {
+    get_var(pose, "id"_var) = 1;
+    get_var(pose, "stamp"_var) = 2.0;
+  }
+  for (const auto& pose : poses)
+  {
+    EXPECT_EQ(get_var(pose, "id"_var), 1);
+  }
+
+  const auto profile = find_profile("my_ns::WirePose");
+  ASSERT_EQ(profile.member_names.size(), 7UL);
+  EXPECT_EQ(profile.member_names[0], "id");
+  EXPECT_EQ(profile.counts[0], 20UL);
+  EXPECT_EQ(profile.counts[4], 10UL);
+  EXPECT_EQ(profile.counts[1], 0UL);
+  EXPECT_EQ(profile.offsets[0], 0);
+  EXPECT_EQ(profile.sizes[4], sizeof(double));
+
+  // id and stamp were accessed together once per object
+  EXPECT_EQ(profile.co_access[0 * 7 + 4], 10UL);
+}
+
+TEST(Profile, CountsAcrossThreads)
+{
+  my_ns::Scale scale{};
+  const auto before = find_profile("my_ns::Scale");
+  const std::uint64_t before_count = before.counts.empty() ? 0 : before.counts[0];
+
+  std::thread worker{[] {
+    my_ns::Scale local{};
+    for (int i = 0; i < 5; ++i)
+    {
+      get_leaf<0>(local) = i;
+    }
+  }};
+  worker.join();
+  get_public_vars(scale);
+
+  const auto after = find_profile("my_ns::Scale");
+  ASSERT_EQ(after.counts.size(), 1UL);
+  EXPECT_EQ(after.counts[0], before_count + 6);
+}
+
+TEST(Profile, Report)
+{
+  my_ns::MyClass obj;
+  for (int i = 0; i < 3; ++i)
+  {
+    get_var(obj, "c"_var) = i;
+  }
+  for_each_leaf([](auto index, auto& leaf) { leaf = {}; }, obj);
+
+  std::ostringstream oss;
+  write_field_access_report(oss);
+
+  const auto report = oss.str();
+  const auto type_pos = report.find("my_ns::MyClass");
+  ASSERT_NE(type_pos, std::string::npos);
+
+  // "c" is hottest, so it is ranked first
+  const auto c_pos = report.find("\n  c ", type_pos);
+  const auto a_pos = report.find("\n  a ", type_pos);
+  ASSERT_NE(c_pos, std::string::npos);
+  ASSERT_NE(a_pos, std::string::npos);
+  EXPECT_LT(c_pos, a_pos);
+}
+
+TEST(Profile, LibraryAccessesAreNotRecorded)
+{
+  my_ns::WirePose pose{};
+  get_var(pose, "id"_var) = 1;
+  const auto before = find_profile("my_ns::WirePose");
+  const auto before_scale = find_profile("my_ns::Scale");
+
+  std::ostringstream oss;
+  oss << fmt(pose);
+  EXPECT_GE(deep_size(pose), sizeof(pose));
+
+  const auto after = find_profile("my_ns::WirePose");
+  EXPECT_EQ(after.counts, before.counts);
+  EXPECT_EQ(after.co_access, before.co_access);
+  EXPECT_EQ(find_profile("my_ns::Scale").counts, before_scale.counts);
+}
@@ -0,0 +1,223 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/protobuf.hpp>
+
+struct Trade
+{
+  std::string symbol;
+  std::vector<int> sizes;
+  std::vector<std::string> venues;
+  std::vector<my_ns::Something> fills;
+  std::int64_t stamp;
+};
+
+namespace about
+{
+namespace detail
+{
+
+template <> struct ClassMetaInfo<::Trade>
+{
+  static constexpr const char* name = "Trade";
+  static constexpr const char* absolute_name = "Trade";
+
+  struct MemberInfo__Trade__symbol
+  {
+    using type = std::string;
+    static constexpr const char* name = "symbol";
+  };
+
+  struct MemberInfo__Trade__sizes
+  {
+    using type = std::vector<int>;
+    static constexpr const char* name = "sizes";
+  };
+
+  struct MemberInfo__Trade__venues
+  {
+    using type = std::vector<std::string>;
+    static constexpr const char* name = "venues";
+  };
+
+  struct MemberInfo__Trade__fills
+  {
+    using type = std::vector<my_ns::Something>;
+    static constexpr const char* name = "fills";
+  };
+
+  struct MemberInfo__Trade__stamp
+  {
+    using type = std::int64_t;
+    static constexpr const char* name = "stamp";
+    static constexpr int field_number = 20;
+  };
+
+  using public_var_info = std::tuple<
+    MemberInfo__Trade__symbol,
+    MemberInfo__Trade__sizes,
+    MemberInfo__Trade__venues,
+    MemberInfo__Trade__fills,
+    MemberInfo__Trade__stamp>;
+
+  static constexpr decltype(auto) public_vars(::Trade& v)
+  {
+    return std::tie(v.symbol, v.sizes, v.venues, v.fills, v.stamp);
+  }
+
+  static constexpr decltype(auto) public_vars(const ::Trade& v)
+  {
+    return std::tie(v.symbol, v.sizes, v.venues, v.fills, v.stamp);
+  }
+};
+
+}  // namespace detail
+}  // namespace about
+
+using namespace about;
+
+namespace
+{
+
+std::string bytes(std::initializer_list<int> values)
+{
+  std::string s;
+  for (const int v : values)
+  {
+    s.push_back(static_cast<char>(v));
+  }
+  return s;
+}
+
+}  // namespace
+
+TEST(Protobuf, FieldNumbers)
+{
+  static_assert(protobuf::field_number<my_ns::Quote>("id"_var) == 1, "");
+  static_assert(protobuf::field_number<my_ns::Quote>("price"_var) == 10, "");
+  static_assert(protobuf::field_number<my_ns::Quote>("volume"_var) == 3, "");
+  static_assert(protobuf::field_number<Trade>("fills"_var) == 4, "");
+  static_assert(protobuf::field_number<Trade>("stamp"_var) == 20, "");
+}
+
+TEST(Protobuf, EncodeScalars)
+{
+  my_ns::Quote quote{};
+  quote.id = 150;
+  quote.price = 1.0;
+
+  // Default scalars are omitted; embedded messages are always written
+  const std::string expected = bytes({0x08, 0x96, 0x01, 0x51, 0, 0, 0, 0, 0, 0, 0xF0, 0x3F, 0x2A, 0x00});
+  EXPECT_EQ(protobuf::encode(quote), expected);
+  EXPECT_EQ(protobuf::encoded_size(quote), expected.size());
+}
+
+TEST(Protobuf, NegativeIntegersUseTenBytes)
+{
+  my_ns::Quote quote{};
+  quote.id = -1;
+  const auto encoded = protobuf::encode(quote);
+  EXPECT_EQ(encoded.size(), 1UL + 10UL + 2UL);
+  EXPECT_EQ(protobuf::decode<my_ns::Quote>(encoded).id, -1);
+}
+
+TEST(Protobuf, EncodePackedAndRepeated)
+{
+  Trade trade{};
+  trade.sizes = {1, 2, 300};
+  trade.venues = {"a", "bc"};
+
+  const std::string expected =
+    bytes({0x12, 0x04, 0x01, 0x02, 0xAC, 0x02, 0x1A, 0x01, 'a', 0x1A, 0x02, 'b', 'c'});
+  EXPECT_EQ(protobuf::encode(trade), expected);
+}
+
+TEST(Protobuf, RoundTrip)
+{
+  my_ns::Quote quote{};
+  quote.id = 7;
+  quote.price = -12.5;
+  quote.volume = 4000000000U;
+  quote.kind = my_ns::MyEnum::CODE;
+  quote.detail.real_number = 0.25f;
+
+  const auto quote_decoded = protobuf::decode<my_ns::Quote>(protobuf::encode(quote));
+  EXPECT_EQ(quote_decoded.id, quote.id);
+  EXPECT_EQ(quote_decoded.price, quote.price);
+  EXPECT_EQ(quote_decoded.volume, quote.volume);
+  EXPECT_EQ(quote_decoded.kind, quote.kind);
+  EXPECT_EQ(quote_decoded.detail.real_number, quote.detail.real_number);
+
+  Trade trade{};
+  trade.symbol = std::string(200, 's');
+  trade.sizes = {-5, 0, 5, 1 << 30};
+  trade.venues = {"", "x"};
+  trade.fills.resize(3);
+  trade.fills[1].real_number = 3.0f;
+  trade.stamp = 1234567890123LL;
+
+  const auto trade_decoded = protobuf::decode<Trade>(protobuf::encode(trade));
+  EXPECT_EQ(trade_decoded.symbol, trade.symbol);
+  EXPECT_EQ(trade_decoded.sizes, trade.sizes);
+  EXPECT_EQ(trade_decoded.venues, trade.venues);
+  ASSERT_EQ(trade_decoded.fills.size(), 3UL);
+  EXPECT_EQ(trade_decoded.fills[1].real_number, 3.0f);
+  EXPECT_EQ(trade_decoded.stamp, trade.stamp);
+}
+
+TEST(Protobuf, DecodeUnpackedRepeatedScalars)
+{
+  const auto trade = protobuf::decode<Trade>(bytes({0x10, 0x01, 0x10, 0x02, 0x12, 0x01, 0x03}));
+  EXPECT_EQ(trade.sizes, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(Protobuf, DecodeSkipsUnknownFields)
+{
+  const std::string encoded = bytes({
+    0x38, 0x96, 0x01,                    // 7: varint
+    0x41, 1, 2, 3, 4, 5, 6, 7, 8,        // 8: fixed64
+    0x4A, 0x03, 'x', 'y', 'z',           // 9: length-delimited
+    0x5D, 1, 2, 3, 4,                    // 11: fixed32
+    0x08, 0x2A,                          // 1: id = 42
+  });
+  const auto quote = protobuf::decode<my_ns::Quote>(encoded);
+  EXPECT_EQ(quote.id, 42);
+}
+
+TEST(Protobuf, DecodeMalformed)
+{
+  EXPECT_THROW(protobuf::decode<my_ns::Quote>(bytes({0x08})), std::runtime_error);
+  EXPECT_THROW(protobuf::decode<my_ns::Quote>(bytes({0x08, 0x80})), std::runtime_error);
+  EXPECT_THROW(protobuf::decode<my_ns::Quote>(bytes({0x51, 0, 0, 0})), std::runtime_error);
+  EXPECT_THROW(protobuf::decode<Trade>(bytes({0x0A, 0x05, 'a'})), std::runtime_error);
+  EXPECT_THROW(protobuf::decode<my_ns::Quote>(bytes({0x0A, 0x05})), std::runtime_error);  // truncated id as bytes
+  EXPECT_THROW(protobuf::decode<my_ns::Quote>(bytes({0x3B})), std::runtime_error);        // group
+}
+
+TEST(Protobuf, DecodeSkipsFieldsWithOtherWireTypes)
+{
+  // id as bytes, then as fixed32, then volume
+  const auto quote = protobuf::decode<my_ns::Quote>(bytes({0x0A, 0x01, 'x', 0x0D, 1, 2, 3, 4, 0x18, 0x07}));
+  EXPECT_EQ(quote.id, 0);
+  EXPECT_EQ(quote.volume, 7U);
+
+  // sizes as fixed32, venues as varint, then stamp
+  const auto trade = protobuf::decode<Trade>(bytes({0x15, 1, 2, 3, 4, 0x18, 0x01, 0xA0, 0x01, 0x09}));
+  EXPECT_TRUE(trade.sizes.empty());
+  EXPECT_TRUE(trade.venues.empty());
+  EXPECT_EQ(trade.stamp, 9);
+}
@@ -0,0 +1,81 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/seqlock.hpp>
+
+using namespace about;
+
+TEST(Seqlock, StoreLoad)
+{
+  seqlock<my_ns::MyClass> published;
+  ASSERT_EQ(published.version(), 0UL);
+  ASSERT_EQ(published.load().a, 0);
+
+  my_ns::MyClass obj{};
+  obj.a = 3;
+  obj.c = 4.5;
+  obj.d.b.real_number = -1.0f;
+  published.store(obj);
+
+  const auto copy = published.load();
+  ASSERT_EQ(published.version(), 1UL);
+  ASSERT_EQ(copy.a, 3);
+  ASSERT_EQ(copy.c, 4.5);
+  ASSERT_EQ(copy.d.b.real_number, -1.0f);
+}
+
+TEST(Seqlock, ReadersNeverObserveTornWrites)
+{
+  static constexpr int kWrites = 20000;
+
+  seqlock<my_ns::MyClass> published;
+  std::atomic<bool> done{false};
+  std::atomic<int> torn{0};
+
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 3; ++r)
+  {
+    readers.emplace_back([&] {
+      while (!done.load(std::memory_order_acquire))
+      {
+        const auto copy = published.load();
+        if (copy.b != copy.a || copy.c != copy.a || copy.d.a.real_number != copy.a || copy.d.b.real_number != copy.a)
+        {
+          torn.fetch_add(1);
+        }
+      }
+    });
+  }
+
+  my_ns::MyClass obj{};
+  for (int i = 1; i <= kWrites; ++i)
+  {
+    obj.a = i;
+    obj.b = static_cast<float>(i);
+    obj.c = static_cast<double>(i);
+    obj.d.a.real_number = static_cast<float>(i);
+    obj.d.b.real_number = static_cast<float>(i);
+    published.store(obj);
+  }
+  done.store(true, std::memory_order_release);
+
+  for (auto& reader : readers)
+  {
+    reader.join();
+  }
+  ASSERT_EQ(torn.load(), 0);
+  ASSERT_EQ(published.load().a, kWrites);
+  ASSERT_EQ(published.version(), static_cast<std::uint64_t>(kWrites));
+}
@@ -0,0 +1,108 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <string>
+
+// POSIX
+#include <sys/wait.h>
+#include <unistd.h>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/shm_queue.hpp>
+
+using namespace about;
+
+namespace
+{
+
+std::string segment_name(const char* suffix) { return "/about-shm-queue-test-" + std::to_string(::getpid()) + suffix; }
+
+}  // namespace
+
+TEST(LayoutHash, DistinguishesTypes)
+{
+  static_assert(layout_hash<my_ns::MyClass>() == layout_hash<const my_ns::MyClass&>(), "hash is not stable");
+  ASSERT_NE(layout_hash<my_ns::Something>(), layout_hash<my_ns::SomethingElse>());
+  ASSERT_NE(layout_hash<int>(), layout_hash<float>());
+  ASSERT_NE(layout_hash<int>(), layout_hash<unsigned>());
+}
+
+TEST(ShmQueue, PushPop)
+{
+  const auto name = segment_name("-push-pop");
+  auto queue = shm_queue<my_ns::MyClass>::create(name, 3);
+  ASSERT_EQ(queue.capacity(), 4UL);
+
+  my_ns::MyClass obj{};
+  for (int i = 0; i < 4; ++i)
+  {
+    obj.a = i;
+    ASSERT_TRUE(queue.try_push(obj));
+  }
+  ASSERT_FALSE(queue.try_push(obj));
+
+  for (int i = 0; i < 4; ++i)
+  {
+    ASSERT_TRUE(queue.try_pop(obj));
+    ASSERT_EQ(obj.a, i);
+  }
+  ASSERT_FALSE(queue.try_pop(obj));
+
+  shm_queue<my_ns::MyClass>::remove(name);
+}
+
+TEST(ShmQueue, AttachRejectsLayoutMismatch)
+{
+  const auto name = segment_name("-mismatch");
+  auto queue = shm_queue<my_ns::SomethingElse>::create(name, 8);
+  ASSERT_NO_THROW(shm_queue<my_ns::SomethingElse>::attach(name));
+  ASSERT_THROW(shm_queue<my_ns::MyClass>::attach(name), std::runtime_error);
+  shm_queue<my_ns::SomethingElse>::remove(name);
+  ASSERT_THROW(shm_queue<my_ns::SomethingElse>::attach(name), std::runtime_error);
+}
+
+TEST(ShmQueue, CrossProcess)
+{
+  static constexpr int kCount = 10000;
+
+  const auto name = segment_name("-cross-process");
+  auto queue = shm_queue<my_ns::MyClass>::create(name, 64);
+
+  const pid_t child = ::fork();
+  ASSERT_GE(child, 0);
+  if (child == 0)
+  {
+    auto producer = shm_queue<my_ns::MyClass>::attach(name);
+    my_ns::MyClass obj{};
+    for (int i = 0; i < kCount; ++i)
+    {
+      obj.a = i;
+      obj.c = 2.0 * i;
+      while (!producer.try_push(obj))
+      {}
+    }
+    ::_exit(0);
+  }
+
+  my_ns::MyClass obj{};
+  for (int i = 0; i < kCount; ++i)
+  {
+    while (!queue.try_pop(obj))
+    {}
+    ASSERT_EQ(obj.a, i);
+    ASSERT_EQ(obj.c, 2.0 * i);
+  }
+
+  int status = 0;
+  ::waitpid(child, &status, 0);
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(WEXITSTATUS(status), 0);
+  shm_queue<my_ns::MyClass>::remove(name);
+}
@@ -0,0 +1,139 @@
+/**
+ * @copyright 2022-present About
+ * @author Brian Cairl
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// About
+#include "test/test_classes_with_reflection.meta.hpp"
+#include <about/sort.hpp>
+
+using namespace about;
+
+namespace
+{
+
+std::vector<my_ns::LabeledPose> make_poses(const std::size_t n, const unsigned seed)
+{
+  std::mt19937 rng{seed};
+  std::uniform_int_distribution<int> label{-5, 5};
+  std::uniform_int_distribution<int> id{std::numeric_limits<int>::lowest(), std::numeric_limits<int>::max()};
+  std::uniform_real_distribution<float> x{-100.f, 100.f};
+
+  std::vector<my_ns::LabeledPose> poses(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    poses[i].id = id(rng);
+    poses[i].x = x(rng);
+    poses[i].label = label(rng);
+    poses[i].y = static_cast<float>(i);
+  }
+  return poses;
+}
+
+template <typename KeyT> std::vector<unsigned char> radix_key(const KeyT value)
+{
+  std::vector<unsigned char> key(detail::RadixKey<KeyT>::size);
+  detail::RadixKey<KeyT>::write(key.data(), value);
+  return key;
+}
+
+template <typename KeyT> void expect_key_order(const std::vector<KeyT>& ascending)
+{
+  for (std::size_t i = 1; i < ascending.size(); ++i)
+  {
+    const auto lhs = radix_key(ascending[i - 1]);
+    const auto rhs = radix_key(ascending[i]);
+    EXPECT_LT(std::memcmp(lhs.data(), rhs.data(), lhs.size()), 0) << i;
+  }
+}
+
+}  // namespace
+
+TEST(Var, Index)
+{
+  static_assert(var_index<my_ns::MyClass>("a"_var) == 0, "");
+  static_assert(var_index<my_ns::MyClass>("d"_var) == 3, "");
+  static_assert(std::is_same<var_t<my_ns::MyClass, decltype("c"_var)>, double>::value, "");
+
+  my_ns::MyClass obj;
+  get_var(obj, "c"_var) = 2.5;
+  EXPECT_EQ(obj.c, 2.5);
+}
+
+TEST(Sort, KeysPreserveOrder)
+{
+  expect_key_order<int>({std::numeric_limits<int>::lowest(), -2, -1, 0, 1, std::numeric_limits<int>::max()});
+  expect_key_order<unsigned short>({0, 1, 255, 256, 65535});
+  expect_key_order<double>(
+    {-std::numeric_limits<double>::infinity(), -1e300, -1.0, -1e-300, -0.0, 0.0, 1e-300, 1.0, 1e300,
+     std::numeric_limits<double>::infinity()});
+  expect_key_order<float>({-3.5f, -0.5f, 0.0f, 0.25f, 7.0f});
+  expect_key_order<my_ns::MyEnum>({my_ns::MyEnum::THIS, my_ns::MyEnum::IS, my_ns::MyEnum::A, my_ns::MyEnum::CODE});
+}
+
+TEST(Sort, SingleKeyMatchesStableSort)
+{
+  auto poses = make_poses(1000, 1);
+  auto expected = poses;
+  std::stable_sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) { return lhs.x < rhs.x; });
+
+  sort_by(poses, "x"_var);
+  for (std::size_t i = 0; i < poses.size(); ++i)
+  {
+    ASSERT_EQ(poses[i].x, expected[i].x);
+    ASSERT_EQ(poses[i].y, expected[i].y);
+  }
+}
+
+TEST(Sort, MultipleKeysMatchStableSort)
+{
+  auto poses = make_poses(5000, 2);
+  auto expected = poses;
+  std::stable_sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) {
+    return std::tie(lhs.label, lhs.id) < std::tie(rhs.label, rhs.id);
+  });
+
+  sort_by(poses, "label"_var, "id"_var);
+  for (std::size_t i = 0; i < poses.size(); ++i)
+  {
+    ASSERT_EQ(poses[i].label, expected[i].label);
+    ASSERT_EQ(poses[i].id, expected[i].id);
+    ASSERT_EQ(poses[i].y, expected[i].y);
+  }
+}
+
+TEST(Sort, SmallInputs)
+{
+  std::vector<my_ns::LabeledPose> empty;
+  sort_by(empty, "id"_var);
+  EXPECT_TRUE(empty.empty());
+
+  auto poses = make_poses(10, 3);
+  sort_by(poses, "label"_var);
+  EXPECT_TRUE(std::is_sorted(
+    poses.begin(), poses.end(), [](const auto& lhs, const auto& rhs) { return lhs.label < rhs.label; }));
+}
+
+TEST(Sort, ParallelMatchesSerial)
+{
+  auto serial = make_poses(100000, 4);
+  auto parallel = serial;
+
+  detail::sort_by<std::uint32_t>(serial, 1, "label"_var, "x"_var);
+  detail::sort_by<std::uint32_t>(parallel, 4, "label"_var, "x"_var);
+  for (std::size_t i = 0; i < serial.size(); ++i)
+  {
+    ASSERT_EQ(serial[i].y, parallel[i].y);
+  }
+}
@@ -2,6 +2,11 @@
  * @copyright 2022-present About
  * @author Brian Cairl
  */
+#ifndef ABOUT_TEST_CLASSES_HPP
+#define ABOUT_TEST_CLASSES_HPP
+
+// About
+#include <about/about.hpp>
 
 namespace my_ns
 {
@@ -42,6 +47,41 @@ private:
   const char* privates = "don't touch me";
 };
 
+struct Scale
+{
+  double real_number;
+};
+
+struct WirePose
+{
+  int id;
+  float x;
+  float y;
+  float z;
+  double stamp;
+  Something scale;
+  int sequence;
+};
+
+struct Pose
+{
+  double stamp;
+  int id;
+  float x;
+  float y;
+  float z;
+  Scale scale;
+};
+
+struct LabeledPose
+{
+  int id;
+  float x;
+  float y;
+  float z;
+  int label;
+};
+
 enum class MyEnum
 {
   THIS,
@@ -50,4 +90,39 @@ enum class MyEnum
   CODE
 };
 
+/// Enumerators at the limits of 64-bit underlying types
+enum class Lowest : long long
+{
+  MIN = -9223372036854775807LL - 1,
+  ZERO = 0
+};
+
+enum class Sentinel : unsigned long long
+{
+  NONE = 0,
+  ALL = 0xFFFFFFFFFFFFFFFFULL
+};
+
+struct Quote
+{
+  int id;
+  ABOUT_FIELD_NUMBER(10) double price;
+  unsigned volume;
+  MyEnum kind;
+  Something detail;
+};
+
+struct Fill
+{
+  ABOUT_FIELD_RANGE(0, 1000) int quantity;
+  ABOUT_FIELD_RANGE(-8, 7) int offset;
+  MyEnum kind;
+  bool urgent;
+  float price;
+  Something detail;
+  unsigned sequence;
+};
+
 }  // namespace my_ns
+
+#endif  // ABOUT_TEST_CLASSES_HPP
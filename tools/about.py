@@ -8,30 +8,45 @@ from pygccxml import utils
 from pygccxml import parser as xml_parser
 
 # About
+from impl.common import about_include_dir
 from impl.generate_meta import generate_meta
 from impl.generate_enum_ostream import generate_enum_ostream
+from impl.generate_module import (generate_header_unit, generate_module_interface)
 
 if __name__ == '__main__':
     parser = argparse.ArgumentParser()
     parser.add_argument("-i",  "--inputs", nargs="*", required=True, help="Input file paths", default=None)
     parser.add_argument("-om", "--output-meta", type=str, help="Output file path", default=None)
     parser.add_argument("-oe", "--output-enum-ostream", type=str, help="Output file path for enum utilities", default=None)
+    parser.add_argument("-ou", "--output-header-unit", type=str, help="Output file path for single header with all generated code", default=None)
+    parser.add_argument("-oi", "--output-module-interface", type=str, help="Output file path for C++20 module interface unit", default=None)
+    parser.add_argument("-mn", "--module-name", type=str, help="Name of exported C++20 module", default=None)
     parser.add_argument("-d",  "--debug", action="store_true", help="Print generated file contents to console")
     args = parser.parse_args()
 
     # Find the location of the xml generator (castxml or gccxml)
     generator_path, generator_name = utils.find_xml_generator()
 
-    # Configure the xml generator
-    xml_generator_config = xml_parser.xml_generator_configuration_t(
-        castxml_epic_version=1,
-        xml_generator_path=generator_path,
-        xml_generator=generator_name)
-
-    decls = xml_parser.parse(args.inputs, xml_generator_config)
+    # Configure the xml generator; reflected headers may include <about/about.hpp> (e.g. for ABOUT_FIELD_NUMBER)
+    with about_include_dir() as include_dir:
+        xml_generator_config = xml_parser.xml_generator_configuration_t(
+            castxml_epic_version=1,
+            xml_generator_path=generator_path,
+            xml_generator=generator_name,
+            include_paths=[include_dir],
+            # Makes ABOUT_FIELD_NUMBER(n) and ABOUT_FIELD_RANGE(min, max) visible as annotation attributes (see about.hpp)
+            define_symbols=[
+                'ABOUT_FIELD_NUMBER(number)=__attribute__((annotate(\\"about_field_number=\\" #number)))',
+                'ABOUT_FIELD_RANGE(min,max)=__attribute__((annotate(\\"about_field_range=\\" #min \\",\\" #max)))',
+            ])
+
+        decls = xml_parser.parse(args.inputs, xml_generator_config)
 
     if (args.output_meta or args.debug):
         generate_meta(args=args, decls=decls)
 
     if (args.output_enum_ostream or args.debug):
         generate_enum_ostream(args=args, decls=decls)
+
+    generate_header_unit(args=args)
+    generate_module_interface(args=args)
@@ -1,8 +1,46 @@
 #!/bin/python
 
 # Standard Library
+import contextlib
+import os
 import sys
-from typing import (Optional)
+import tempfile
+from typing import (Iterator, Optional)
+
+# About headers, as installed by //:about and //:utility (see BUILD), are found relative to this file
+ABOUT_INCLUDE_DIRS = [
+    os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "include"),
+    os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "include", "utility"),
+]
+
+
+@contextlib.contextmanager
+def about_include_dir() -> Iterator[str]:
+    """
+    Yields a temporary include directory from which About headers are found as <about/name>, as they are when built
+
+    Used to parse headers which include <about/about.hpp>, e.g. for ABOUT_FIELD_NUMBER
+    """
+    with tempfile.TemporaryDirectory() as root:
+        os.mkdir(os.path.join(root, "about"))
+        for include_dir in ABOUT_INCLUDE_DIRS:
+            for name in os.listdir(include_dir):
+                if name.endswith(".hpp"):
+                    os.symlink(os.path.abspath(os.path.join(include_dir, name)), os.path.join(root, "about", name))
+        yield root
+
+
+def is_declared_in(decl, paths) -> bool:
+    """
+    Returns True if decl is declared in one of the files, paths
+
+    Used to reflect only declarations of the input headers, and not those of the headers they include
+    """
+    location = getattr(decl, "location", None)
+    if location is None:
+        return False
+    return os.path.realpath(location.file_name) in {os.path.realpath(path) for path in paths}
+
 
 def open_output_handle(filename:Optional[str] = None, mode:str = "w+"):
     """
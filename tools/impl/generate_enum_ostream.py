@@ -8,7 +8,7 @@ from typing import (Dict, List, Optional)
 from pygccxml import declarations
 
 # About
-from impl.common import open_output_handle
+from impl.common import (is_declared_in, open_output_handle)
 
 START_OF_FILE = """
 /**
@@ -94,7 +94,9 @@ namespace about
             if isinstance(n, declarations.namespace_t):
                 inner_ns = global_ns.namespace(n.name)
                 for n in inner_ns.declarations:
-                    if isinstance(n, declarations.enumeration_t):
+                    if not is_declared_in(n, args.inputs):
+                        continue
+                    elif isinstance(n, declarations.enumeration_t):
                         expand_enum(out, inner_ns.name, n)
                     elif isinstance(n, declarations.class_t):
                         expand_class(out, inner_ns.name, n)
@@ -2,13 +2,14 @@
 
 # Standard Library
 import os
-from typing import (Dict, List, Optional)
+import re
+from typing import (Dict, List, Optional, Tuple)
 
 # PyGCCXML
 from pygccxml import declarations
 
 # About
-from impl.common import open_output_handle
+from impl.common import (is_declared_in, open_output_handle)
 
 START_OF_FILE = """
 /**
@@ -19,6 +20,9 @@ START_OF_FILE = """
 
 
 // C++ Standard Library
+#include <cstddef>
+#include <limits>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -34,8 +38,91 @@ END_OF_FILE = """
 """
 
 
+FIELD_NUMBER_ANNOTATION = re.compile(r"annotate\(about_field_number=(\d+)\)")
+
+
+def match_annotation(class_name:str, v, key:str, pattern:re.Pattern) -> Optional[re.Match]:
+    """
+    Returns the match of an annotation of member variable v, or None if v does not have the annotation
+
+    Raises ValueError if v has the annotation, but its arguments are not integer literals (e.g. a constant name)
+    """
+    attributes = getattr(v, "attributes", None) or ""
+    if f"annotate({key}=" not in attributes:
+        return None
+    match = pattern.search(attributes)
+    if not match:
+        raise ValueError(f"{class_name}::{v.name} has an unparsable annotation {attributes!r}; arguments must be integer literals")
+    return match
+
+# Largest protobuf field number, and range reserved by protobuf
+MAX_FIELD_NUMBER = (1 << 29) - 1
+RESERVED_FIELD_NUMBERS = range(19000, 20000)
+
+
+def field_numbers(class_name:str, variables) -> List[int]:
+    """
+    Returns protobuf field numbers of public member variables
+
+    Variables are numbered from 1, in order of declaration, unless annotated with ABOUT_FIELD_NUMBER(n)
+    """
+    numbers = []
+    for index, v in enumerate(variables):
+        match = match_annotation(class_name, v, "about_field_number", FIELD_NUMBER_ANNOTATION)
+        number = int(match.group(1)) if match else (index + 1)
+        if not (1 <= number <= MAX_FIELD_NUMBER) or number in RESERVED_FIELD_NUMBERS:
+            raise ValueError(f"{class_name}::{v.name} has invalid field number {number}")
+        if number in numbers:
+            raise ValueError(f"{class_name}::{v.name} reuses field number {number}")
+        numbers.append(number)
+    return numbers
+
+
+FIELD_RANGE_ANNOTATION = re.compile(r"annotate\(about_field_range=(-?\d+),(-?\d+)\)")
+
+
+def field_range(class_name:str, v) -> Optional[Tuple[int, int]]:
+    """
+    Returns (min, max) of a member variable annotated with ABOUT_FIELD_RANGE(min, max), or None
+    """
+    match = match_annotation(class_name, v, "about_field_range", FIELD_RANGE_ANNOTATION)
+    if not match:
+        return None
+    lo, hi = int(match.group(1)), int(match.group(2))
+    if lo > hi:
+        raise ValueError(f"{class_name}::{v.name} has empty range [{lo}, {hi}]")
+    return (lo, hi)
+
+
+# Range of long long, in which enumerator ranges are given
+LLONG_MIN = -(1 << 63)
+LLONG_MAX = (1 << 63) - 1
+
+
+def long_long_literal(value:int) -> str:
+    """
+    Returns a long long constant expression for value; -2^63 can not be written as a literal
+    """
+    return "std::numeric_limits<long long>::min()" if value == LLONG_MIN else f"{value}LL"
+
+
+def enum_range(values:List[int]) -> str:
+    """
+    Returns declarations of the smallest and largest enumerator values, or a comment if they do not fit long long
+
+    Without min_value and max_value, utilities treat the enum as spanning its whole underlying type
+    """
+    lo, hi = min(values, default=0), max(values, default=0)
+    if lo < LLONG_MIN or hi > LLONG_MAX:
+        return "// Enumerator values do not fit long long, so their range is not given"
+    return f"""// Smallest and largest enumerator values
+    static constexpr long long min_value = {long_long_literal(lo)};
+    static constexpr long long max_value = {long_long_literal(hi)};"""
+
+
 def expand_enum(out, ns_name:str, decl):
     fully_qualified_enum_name = f"{ns_name}::{decl.name}"
+    values = [value for _, value in decl.values]
     out.write(f"""
 template<>
 struct ClassMetaInfo<{ns_name}::{decl.name}>
@@ -45,6 +132,11 @@ struct ClassMetaInfo<{ns_name}::{decl.name}>
 
     // Absolute enum name as string literal
     static constexpr const char* absolute_name = \"{ns_name}::{decl.name}\";
+
+    // Number of enumerators
+    static constexpr std::size_t value_count = {len(values)};
+
+    {enum_range(values)}
 }};
 """)
 
@@ -62,19 +154,25 @@ struct ClassMetaInfo<{ns_name}::{decl.name}>
     static constexpr const char* absolute_name = \"{ns_name}::{decl.name}\";
 """)
 
+    public_vars = [v for v in decl.public_members if isinstance(v, declarations.variable_t)]
+
     member_name_wrappers = []
-    for v in decl.public_members:
-        if isinstance(v, declarations.variable_t):
-            member_name_wrappers.append(f"MemberInfo__{decl.name}__{v.name}")
-            if isinstance(v._decl_type, declarations.declarated_t):
-                var_type_name = f"{ns_name}::{v.decl_type.declaration.name}"
-            else:
-                var_type_name = v.decl_type._name
-            out.write(f"""
+    for v, number in zip(public_vars, field_numbers(f"{ns_name}::{decl.name}", public_vars)):
+        member_name_wrappers.append(f"MemberInfo__{decl.name}__{v.name}")
+        if isinstance(v._decl_type, declarations.declarated_t):
+            var_type_name = f"{ns_name}::{v.decl_type.declaration.name}"
+        else:
+            var_type_name = v.decl_type._name
+        value_range = field_range(f"{ns_name}::{decl.name}", v)
+        range_lines = "" if value_range is None else f"""
+    static constexpr long long range_min = {value_range[0]}LL;
+    static constexpr long long range_max = {value_range[1]}LL;"""
+        out.write(f"""
 struct MemberInfo__{decl.name}__{v.name}
 {{
     using type = {var_type_name};
     static constexpr const char* name = "{v.name}";
+    static constexpr int field_number = {number};{range_lines}
 }};
 """)
 
@@ -162,7 +260,9 @@ namespace detail
             if isinstance(n, declarations.namespace_t):
                 inner_ns = global_ns.namespace(n.name)
                 for n in inner_ns.declarations:
-                    if isinstance(n, declarations.class_t):
+                    if not is_declared_in(n, args.inputs):
+                        continue
+                    elif isinstance(n, declarations.class_t):
                         expand_class(out, inner_ns.name, n)
                     elif isinstance(n, declarations.enumeration_t):
                         expand_enum(out, inner_ns.name, n)
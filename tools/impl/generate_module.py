@@ -0,0 +1,160 @@
+#!/bin/python
+
+# Standard Library
+import os
+import re
+from typing import (List, Optional, Set)
+
+# About
+from impl.common import (ABOUT_INCLUDE_DIRS, open_output_handle)
+
+# Matches #include <name> and #include "name", capturing the delimiter and name
+INCLUDE_DIRECTIVE = re.compile(r'^[ \t]*#[ \t]*include[ \t]*([<"])([^>"]+)[>"]', re.MULTILINE)
+
+# Core About headers wrapped along with the generated code
+ABOUT_HEADERS = [
+    "about/about.hpp",
+    "about/for_each.hpp",
+    "about/fmt.hpp",
+]
+
+HEADER_UNIT_START_OF_FILE = """
+/**
+ * THIS CODE WAS AUTO-GENERATED
+ *
+ * Single header with all generated reflection code, for use as a precompiled header or C++20 header unit
+ */
+#ifndef {gaurd}__MODULE_HPP
+#define {gaurd}__MODULE_HPP
+
+"""
+
+HEADER_UNIT_END_OF_FILE = """
+#endif // {gaurd}__MODULE_HPP
+"""
+
+MODULE_INTERFACE = """
+/**
+ * THIS CODE WAS AUTO-GENERATED
+ *
+ * C++20 module interface unit exporting About and all generated reflection code
+ */
+module;
+
+// Headers included by the exported code (C++ Standard Library, and others)
+{external_includes}
+
+export module {module_name};
+
+export extern "C++"
+{{
+#include "{header_unit}"
+}}
+"""
+
+
+def _includes(headers:List[str], quoted:bool) -> str:
+    if quoted:
+        return "\n".join([f"#include \"{h}\"" for h in headers])
+    return "\n".join([f"#include <{h}>" for h in headers])
+
+
+def _find_about_header(name:str) -> str:
+    """
+    Returns path of About header included as <about/name>
+    """
+    for include_dir in ABOUT_INCLUDE_DIRS:
+        path = os.path.join(include_dir, name)
+        if os.path.isfile(path):
+            return path
+    raise ValueError(f"Could not find About header <about/{name}> in {ABOUT_INCLUDE_DIRS}")
+
+
+def _find_quoted_header(name:str, including_file:str) -> Optional[str]:
+    """
+    Returns path of header included as "name", relative to the including file or to the working directory, or None
+    """
+    for path in (os.path.join(os.path.dirname(including_file), name), name):
+        if os.path.isfile(path):
+            return path
+    return None
+
+
+def external_includes(paths:List[str]) -> List[str]:
+    """
+    Returns every <...> include, other than About headers, reached from the files in paths
+
+    About headers and quoted includes which can be found are followed recursively. Every include is collected,
+    whether or not it is conditional, so that none is expanded inside the purview of a module which wraps these
+    files. Headers which are not otherwise used are harmless in a global module fragment.
+    """
+    visited:Set[str] = set()
+    found:Set[str] = set()
+    pending = list(paths)
+    while pending:
+        path = os.path.realpath(pending.pop())
+        if path in visited:
+            continue
+        visited.add(path)
+        with open(path, "r") as f:
+            text = f.read()
+        for delimiter, name in INCLUDE_DIRECTIVE.findall(text):
+            if delimiter == '"':
+                header = _find_quoted_header(name, path)
+                if header:
+                    pending.append(header)
+            elif name.startswith("about/"):
+                pending.append(_find_about_header(name[len("about/"):]))
+            else:
+                found.add(name)
+    return sorted(found)
+
+
+def _wrapped_includes(args) -> List[str]:
+    """
+    Returns external includes of everything wrapped by the header unit: About, generated code and user headers
+    """
+    generated = [f for f in (args.output_meta, args.output_enum_ostream) if f]
+    about = [_find_about_header(h[len("about/"):]) for h in ABOUT_HEADERS]
+    return external_includes(about + generated + list(args.inputs))
+
+
+def generate_header_unit(args):
+    if not args.output_header_unit:
+        return
+    output = args.output_header_unit
+    base, ext = os.path.splitext(os.path.split(output.upper())[-1])
+    include_gaurd = f"__ABOUT_AUTO_GENERATED__{base}"
+    include_gaurd = include_gaurd.replace("-", "_")
+    include_gaurd = include_gaurd.replace(".", "_")
+
+    # Generated headers are emitted alongside this one
+    generated = [os.path.basename(f) for f in (args.output_meta, args.output_enum_ostream) if f]
+
+    with open_output_handle(output) as out:
+        out.write(HEADER_UNIT_START_OF_FILE.format(gaurd=include_gaurd))
+        out.write("// Headers included by the wrapped code (C++ Standard Library, and others)\n")
+        out.write(_includes(_wrapped_includes(args), quoted=False) + "\n\n")
+        out.write("// About\n")
+        out.write(_includes(ABOUT_HEADERS, quoted=False) + "\n\n")
+        out.write("// GENERATED\n")
+        out.write(_includes(generated, quoted=True) + "\n")
+        out.write(HEADER_UNIT_END_OF_FILE.format(gaurd=include_gaurd))
+
+
+def generate_module_interface(args):
+    if not args.output_module_interface:
+        return
+    if not args.output_header_unit:
+        raise ValueError("A module interface requires a header unit output (--output-header-unit)")
+    if not args.module_name:
+        raise ValueError("A module interface requires a module name (--module-name)")
+
+    # Every header included by the wrapped files, other than About headers, is included in the global module fragment,
+    # so that include guards keep it from being expanded in the module purview; About, generated code and user headers
+    # are exported
+    with open_output_handle(args.output_module_interface) as out:
+        out.write(MODULE_INTERFACE.format(
+            external_includes=_includes(_wrapped_includes(args), quoted=False),
+            module_name=args.module_name,
+            header_unit=os.path.basename(args.output_header_unit)))